@@ -0,0 +1,40 @@
+#----------------------------------*-CMake-*----------------------------------#
+# Copyright 2024 UT-Battelle, LLC and other Celeritas developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+#[=======================================================================[.rst:
+
+FindNUMA
+--------
+
+Find the libnuma NUMA policy library.
+
+.. variable:: NUMA_FOUND
+
+  True if libnuma and its header were found.
+
+.. target:: NUMA::numa
+
+  Imported target for linking against libnuma.
+
+#]=======================================================================]
+
+find_path(NUMA_INCLUDE_DIR numa.h)
+find_library(NUMA_LIBRARY numa)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(NUMA
+  REQUIRED_VARS NUMA_LIBRARY NUMA_INCLUDE_DIR
+)
+
+if(NUMA_FOUND AND NOT TARGET NUMA::numa)
+  add_library(NUMA::numa UNKNOWN IMPORTED)
+  set_target_properties(NUMA::numa PROPERTIES
+    IMPORTED_LOCATION "${NUMA_LIBRARY}"
+    INTERFACE_INCLUDE_DIRECTORIES "${NUMA_INCLUDE_DIR}"
+  )
+endif()
+
+mark_as_advanced(NUMA_INCLUDE_DIR NUMA_LIBRARY)
+
+#-----------------------------------------------------------------------------#
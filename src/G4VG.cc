@@ -7,7 +7,16 @@
 //---------------------------------------------------------------------------//
 #include "G4VG.hh"
 
-#include <geocel/g4vg/Converter.hh>
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+#include <G4LogicalVolume.hh>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "g4vg/Converter.hh"
+#include "g4vg/Estimate.hh"
+#include "g4vg/NumaReplicated.hh"
 
 namespace g4vg
 {
@@ -15,8 +24,8 @@ namespace g4vg
 /*!
  * Convert a Geant4 geometry to a VecGeom geometry.
  *
- * Return the new world volume and a mapping of Geant4 logical volumes to
- * VecGeom-based volume IDs.
+ * Return the new world volume, a mapping of Geant4 logical volumes to dense
+ * g4vg volume IDs, and the material and attributes of each volume.
  */
 Converted convert(G4VPhysicalVolume const* world)
 {
@@ -29,30 +38,173 @@ Converted convert(G4VPhysicalVolume const* world)
  */
 Converted convert(G4VPhysicalVolume const* world, Options options)
 {
-    using Converter = ::celeritas::g4vg::Converter;
+    using Clock = std::chrono::steady_clock;
+
+    auto const start_time = Clock::now();
 
     // Construct converter
     Converter convert{[&options] {
-        Converter::Options geocel_opts;
-        geocel_opts.verbose = options.verbose;
-        geocel_opts.compare_volumes = options.compare_volumes;
-        return geocel_opts;
+        Converter::Options convert_opts;
+        convert_opts.verbose = options.verbose;
+        convert_opts.compare_volumes = options.compare_volumes;
+        convert_opts.wrap_unsupported = options.wrap_unsupported;
+        convert_opts.vecgeom_names = options.vecgeom_names;
+        convert_opts.scale = options.scale;
+        convert_opts.daughter_order = options.daughter_order;
+        convert_opts.profile = options.profile;
+        return convert_opts;
     }()};
 
     // Convert
-    auto geocel_result = convert(world);
+    auto result = convert(world);
+    std::chrono::duration<double> const convert_time = Clock::now()
+                                                       - start_time;
 
-    // Remap output to remove volume IDs
     Converted converted;
-    converted.world = geocel_result.world;
-    converted.volumes.reserve(geocel_result.volumes.size());
-    for (auto&& [lv, vid] : geocel_result.volumes)
+    converted.world = result.world;
+    converted.wrapped.shapes = std::move(result.wrapped);
+    converted.store = std::move(result.store);
+
+    // Number volumes
+    converted.ids = VolumeIds{converted.world, converted.store};
+    auto const& ids = converted.ids;
+    auto& lv_by_id = converted.logical_volumes;
+    lv_by_id.assign(ids.num_volumes(), nullptr);
+    converted.volume_ids.reserve(result.volumes.size());
+    for (auto&& [g4lv, vglv] : result.volumes)
+    {
+        auto const id = ids.id(*vglv);
+        lv_by_id[id] = g4lv;
+        converted.volume_ids.insert({g4lv, id});
+    }
+    if (options.daughter_order != DaughterOrder::geant4)
+    {
+        // The world placement keeps slot zero
+        converted.daughter_slots.assign(ids.num_placements(), 0);
+        for (auto&& [vgpv, slot] : result.daughter_slots)
+        {
+            converted.daughter_slots[ids.id(*vgpv)] = slot;
+        }
+    }
+
+    // Intern Geant4 names in order of volume ID
+    converted.volume_names.reserve(lv_by_id.size());
+    for (auto const* lv : lv_by_id)
+    {
+        converted.volume_names.push_back(
+            converted.names.insert(lv->GetName()));
+    }
+
+    converted.materials = build_material_table(lv_by_id);
+    converted.attributes = build_volume_attributes(lv_by_id, options.gdml_aux);
+    if (options.navigation_tables)
+    {
+        converted.navigation = build_navigation_tables(ids);
+    }
+    if (options.placement_table)
+    {
+        converted.placements = build_placement_table(ids);
+    }
+    if (options.numa_tables && numa_node_count() > 1)
+    {
+        if (options.navigation_tables)
+        {
+            converted.numa_navigation = numa_replicate(converted.navigation);
+        }
+        if (options.placement_table)
+        {
+            converted.numa_placements = numa_replicate(converted.placements);
+        }
+    }
+    if (options.report_unreachable)
+    {
+        converted.unreachable = find_unreachable(world);
+
+        // Extrapolate from the average cost of each volume converted here
+        std::size_t vg_bytes = 0;
+        for (unsigned int id = 0; id != ids.num_volumes(); ++id)
+        {
+            auto const* vglv = ids.volume(id);
+            vg_bytes += sizeof(vecgeom::LogicalVolume)
+                        + vglv->GetUnplacedVolume()->MemorySize()
+                        + vglv->GetDaughters().size()
+                              * (sizeof(vecgeom::VPlacedVolume)
+                                 + sizeof(vecgeom::Transformation3D));
+        }
+        double const skipped_frac
+            = static_cast<double>(converted.unreachable.logical_volumes)
+              / static_cast<double>(converted.volume_ids.size());
+        converted.unreachable.estimated_bytes
+            = static_cast<std::size_t>(skipped_frac * vg_bytes);
+        converted.unreachable.estimated_seconds
+            = skipped_frac * convert_time.count();
+    }
+    if (options.linear_tree)
+    {
+        converted.tree = build_linear_tree(ids);
+    }
+    if (!options.touchable_volumes.empty())
+    {
+        std::vector<bool> selected(lv_by_id.size(), false);
+        for (auto const* lv : options.touchable_volumes)
+        {
+            auto iter = converted.volume_ids.find(lv);
+            if (iter == converted.volume_ids.end())
+            {
+                throw std::invalid_argument(
+                    "touchable volume is not part of the converted geometry");
+            }
+            selected[iter->second] = true;
+        }
+
+        // Count from the Geant4 tree so that nothing is built if too large
+        std::size_t const touchable_bytes = estimate_touchable_bytes(
+            count_touchables(world, options.touchable_volumes));
+        if (touchable_bytes <= options.max_touchable_bytes)
+        {
+            if (converted.tree.empty())
+            {
+                converted.tree = build_linear_tree(ids);
+            }
+            converted.touchables
+                = build_touchable_transforms(ids,
+                                             converted.tree,
+                                             selected,
+                                             options.touchable_threads);
+        }
+        converted.touchables.estimated_bytes = touchable_bytes;
+    }
+    if (options.compact_transforms)
     {
-        converted.volumes.insert({lv, vid.unchecked_get()});
+        converted.transforms
+            = CompactTransforms{ids, options.transform_options};
     }
 
     return converted;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Navigation tables on the NUMA node of the calling thread.
+ *
+ * Without replicas (if they were not requested or the machine has a single
+ * NUMA node) this is \c navigation itself.
+ */
+NavigationTables const& Converted::local_navigation() const
+{
+    auto const node = static_cast<std::size_t>(numa_local_node());
+    return node < numa_navigation.size() ? numa_navigation[node] : navigation;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Placement table on the NUMA node of the calling thread.
+ */
+PlacementTable const& Converted::local_placements() const
+{
+    auto const node = static_cast<std::size_t>(numa_local_node());
+    return node < numa_placements.size() ? numa_placements[node] : placements;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace g4vg
@@ -7,7 +7,24 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <unordered_map>
+#include <vector>
+
+#include "g4vg/CompactTransforms.hh"
+#include "g4vg/DaughterOrder.hh"
+#include "g4vg/LinearTree.hh"
+#include "g4vg/MaterialTable.hh"
+#include "g4vg/NamePool.hh"
+#include "g4vg/NavigationTables.hh"
+#include "g4vg/PlacementTable.hh"
+#include "g4vg/TouchableTransforms.hh"
+#include "g4vg/UnreachableReport.hh"
+#include "g4vg/VolumeAttributes.hh"
+#include "g4vg/VolumeIds.hh"
+#include "g4vg/VolumeStore.hh"
+#include "g4vg/WrappedSolids.hh"
 
 //---------------------------------------------------------------------------//
 // FORWARD DECLARATIONS
@@ -38,6 +55,51 @@ struct Options
     //! Perform conversion checks
     bool compare_volumes{false};
 
+    //! Wrap unsupported solids so that VecGeom calls Geant4 for them
+    bool wrap_unsupported{false};
+
+    //! Label VecGeom volumes and placements (else see Converted::names)
+    bool vecgeom_names{true};
+
+    //! Order of daughters in each converted volume
+    DaughterOrder daughter_order{DaughterOrder::geant4};
+
+    //! Entry counts for profile-guided daughter ordering
+    NavigationProfile const* profile{nullptr};
+
+    //! Pack navigation-hot volume data into contiguous arrays
+    bool navigation_tables{false};
+
+    //! Export a structure-of-arrays table of all placements
+    bool placement_table{false};
+
+    //! Copy the requested navigation/placement tables to every NUMA node
+    bool numa_tables{false};
+
+    //! Flatten the placement hierarchy into a pre-order array
+    bool linear_tree{false};
+
+    //! Encode placement transforms compactly
+    bool compact_transforms{false};
+
+    //! Options for the compact transform encoding
+    CompactTransforms::Options transform_options;
+
+    //! Precompute global transforms for every touchable of these volumes
+    std::vector<G4LogicalVolume const*> touchable_volumes;
+
+    //! Skip building touchables and their tree above this size [bytes]
+    std::size_t max_touchable_bytes{std::numeric_limits<std::size_t>::max()};
+
+    //! Threads for computing touchable transforms (zero for all)
+    unsigned int touchable_threads{0};
+
+    //! Count and estimate the cost of Geant4 objects outside the world tree
+    bool report_unreachable{false};
+
+    //! GDML auxiliary tags to store, e.g. from \c G4GDMLParser::GetAuxMap
+    GdmlAuxMap const* gdml_aux{nullptr};
+
     //! TODO: allow client to use a different unit system (default: mm = 1)
     static constexpr double scale = 1;
 };
@@ -45,17 +107,92 @@ struct Options
 //---------------------------------------------------------------------------//
 /*!
  * Result from converting from Geant4 to VecGeom.
+ *
+ * Every per-volume and per-placement table is indexed by the dense g4vg IDs
+ * in \c ids rather than by VecGeom's process-wide IDs. Volume IDs follow a
+ * depth-first order (each volume's daughters before the volume itself, so
+ * the world has the highest ID), and the same geometry and options always
+ * give the same IDs. The unplaced helper volumes that the converter creates
+ * for the constituents of boolean, scaled, and multi-union solids are
+ * numbered after all volumes reachable from the world, so the tables have no
+ * gaps.
+ *
+ * \note The map from Geant4 logical volumes used to be called \c volumes and
+ * hold VecGeom IDs. It is now \c volume_ids so that code passing its values
+ * to \c GeoManager::FindLogicalVolume fails to compile: use
+ * \c ids.volume(id) to get the VecGeom volume and its ID.
+ *
+ * A converted result owns every VecGeom shape and volume created for it:
+ * destroying it deletes the VecGeom geometry, so it can only be moved.
  */
 struct Converted
 {
     using VGPlacedVolume = vecgeom::VPlacedVolume;
     using MapLvVolId = std::unordered_map<G4LogicalVolume const*, unsigned int>;
+    using VecLv = std::vector<G4LogicalVolume const*>;
 
     //! World pointer (host) corresponding to input Geant4 world
     VGPlacedVolume* world{nullptr};
 
-    //! Map of Geant4 logical volumes to VecGeom LV IDs
-    MapLvVolId volumes;
+    //! Dense IDs of the VecGeom volumes and placements
+    VolumeIds ids;
+
+    //! Map of Geant4 logical volumes to dense volume IDs
+    MapLvVolId volume_ids;
+
+    //! Geant4 logical volume for each volume ID
+    VecLv logical_volumes;
+
+    //! Original daughter index for each placement ID (empty if unchanged)
+    std::vector<unsigned int> daughter_slots;
+
+    //! Unique Geant4 volume names
+    NamePool names;
+
+    //! Name ID in the pool for each volume ID
+    std::vector<unsigned int> volume_names;
+
+    //! Deduplicated materials and per-volume material IDs
+    MaterialTable materials;
+
+    //! Regions, cuts, sensitivity, field, and GDML tags per volume
+    VolumeAttributes attributes;
+
+    //! Packed daughters, shapes, and transforms (if requested)
+    NavigationTables navigation;
+
+    //! Flat per-placement arrays grouped by mother (if requested)
+    PlacementTable placements;
+
+    //! Copies of \c navigation on each NUMA node (if requested)
+    std::vector<NavigationTables> numa_navigation;
+
+    //! Copies of \c placements on each NUMA node (if requested)
+    std::vector<PlacementTable> numa_placements;
+
+    //! Pre-order touchable tree (if requested or needed for touchables)
+    LinearTree tree;
+
+    //! Compact placement transforms by placement ID (if requested)
+    CompactTransforms transforms;
+
+    //! Global transforms of selected touchables, indexed via \c tree
+    TouchableTransforms touchables;
+
+    //! Skipped Geant4 objects (if requested)
+    UnreachableReport unreachable;
+
+    //! Unsupported solids that call back into Geant4
+    WrappedSolids wrapped;
+
+    //! Owner of the VecGeom objects, including \c world
+    VolumeStore store;
+
+    // Navigation tables on the NUMA node of the calling thread
+    NavigationTables const& local_navigation() const;
+
+    // Placement table on the NUMA node of the calling thread
+    PlacementTable const& local_placements() const;
 };
 
 //---------------------------------------------------------------------------//
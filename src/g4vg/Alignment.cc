@@ -0,0 +1,271 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Alignment.cc
+//---------------------------------------------------------------------------//
+#include "Alignment.hh"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <G4LogicalVolume.hh>
+#include <G4VPhysicalVolume.hh>
+#include <VecGeom/management/ABBoxManager.h>
+#include <VecGeom/management/BVHManager.h>
+#include <VecGeom/management/GeoManager.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "SolidConverter.hh"
+#include "Transformer.hh"
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using vecgeom::LogicalVolume;
+using VGPlacedVolume = vecgeom::VPlacedVolume;
+
+//! New object transform for a Geant4 placement
+using Update = std::pair<G4VPhysicalVolume const*, G4Transform3D>;
+
+//---------------------------------------------------------------------------//
+//! Get the converted ID of a Geant4 logical volume
+unsigned int find_volume_id(Converted const& converted,
+                            G4LogicalVolume const* lv)
+{
+    auto iter = converted.volume_ids.find(lv);
+    if (iter == converted.volume_ids.end())
+    {
+        throw std::invalid_argument("volume '" + lv->GetName()
+                                    + "' is not part of the converted "
+                                      "geometry");
+    }
+    return iter->second;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the VecGeom placement of a Geant4 physical volume.
+ *
+ * Each placement in a mother is identified by its daughter volume, copy
+ * number, and name (if VecGeom names were kept), which are independent of
+ * the daughter ordering.
+ */
+VGPlacedVolume const*
+find_placement(Converted const& converted, G4VPhysicalVolume const* g4pv)
+{
+    if (!g4pv)
+    {
+        throw std::invalid_argument("cannot align a null placement");
+    }
+    if (!g4pv->GetMotherLogical())
+    {
+        throw std::invalid_argument("cannot align the world volume '"
+                                    + g4pv->GetName() + "'");
+    }
+    if (g4pv->IsReplicated())
+    {
+        throw std::invalid_argument("cannot align replicated volume '"
+                                    + g4pv->GetName() + "'");
+    }
+
+    auto const mother_id
+        = find_volume_id(converted, g4pv->GetMotherLogical());
+    auto const daughter_id
+        = find_volume_id(converted, g4pv->GetLogicalVolume());
+    LogicalVolume const* daughter = converted.ids.volume(daughter_id);
+
+    VGPlacedVolume const* result = nullptr;
+    for (auto const* pv : converted.ids.volume(mother_id)->GetDaughters())
+    {
+        std::string const label{pv->GetLabel()};
+        if (pv->GetLogicalVolume() == daughter
+            && pv->GetCopyNo() == g4pv->GetCopyNo()
+            && (label.empty() || label == g4pv->GetName()))
+        {
+            if (result)
+            {
+                throw std::runtime_error("placement '" + g4pv->GetName()
+                                         + "' is ambiguous in its mother");
+            }
+            result = pv;
+        }
+    }
+    if (!result)
+    {
+        throw std::runtime_error("placement '" + g4pv->GetName()
+                                 + "' was not converted");
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move placements and refresh everything that depends on their transforms.
+ */
+AlignmentResult align(Converted* converted, std::vector<Update> const& updates)
+{
+    if (!converted || !converted->world)
+    {
+        throw std::invalid_argument("cannot align an empty geometry");
+    }
+    if (converted->volume_ids.empty())
+    {
+        throw std::logic_error(
+            "alignment requires the Geant4 volume map (see "
+            "FreezeOptions::keep_volume_map)");
+    }
+
+    auto const& ids = converted->ids;
+
+    // Look up all placements before modifying any
+    std::vector<VGPlacedVolume const*> placed;
+    placed.reserve(updates.size());
+    for (auto const& [g4pv, g4xf] : updates)
+    {
+        placed.push_back(find_placement(*converted, g4pv));
+    }
+
+    Transformer transform{Options::scale};
+    AlignmentResult result;
+    std::vector<bool> moved(ids.num_placements(), false);
+    std::vector<LogicalVolume const*> mothers;
+    for (std::size_t i = 0; i != updates.size(); ++i)
+    {
+        auto const& [g4pv, g4xf] = updates[i];
+        auto const mother_inverse
+            = unwrap_solid(*g4pv->GetMotherLogical()->GetSolid())
+                  .transform.inverse();
+        auto const daughter_xf
+            = unwrap_solid(*g4pv->GetLogicalVolume()->GetSolid()).transform;
+
+        // VecGeom only exposes the transform of a placement as const, but
+        // the placement owns it
+        auto const* pv = placed[i];
+        *const_cast<vecgeom::Transformation3D*>(pv->GetTransformation())
+            = transform(mother_inverse * g4xf * daughter_xf);
+
+        auto const id = ids.id(*pv);
+        if (!moved[id])
+        {
+            moved[id] = true;
+            ++result.placements;
+        }
+        mothers.push_back(ids.volume(
+            find_volume_id(*converted, g4pv->GetMotherLogical())));
+    }
+    std::sort(mothers.begin(), mothers.end());
+    mothers.erase(std::unique(mothers.begin(), mothers.end()),
+                  mothers.end());
+    result.mothers = mothers.size();
+
+    // Refresh converted tables that were built
+    update_navigation_tables(moved, &converted->navigation);
+    if (!converted->placements.empty())
+    {
+        update_placement_table(ids, moved, &converted->placements);
+    }
+    // NUMA copies are updated in place so they stay on their nodes
+    for (auto& nav : converted->numa_navigation)
+    {
+        update_navigation_tables(moved, &nav);
+    }
+    for (auto& table : converted->numa_placements)
+    {
+        update_placement_table(ids, moved, &table);
+    }
+    if (!converted->transforms.empty())
+    {
+        for (auto const* pv : placed)
+        {
+            converted->transforms.update(ids.id(*pv), *pv);
+        }
+    }
+    result.touchables = update_touchable_transforms(ids,
+                                                    converted->tree,
+                                                    moved,
+                                                    &converted->touchables);
+
+    // Refresh VecGeom acceleration structures built when it was closed
+    if (vecgeom::GeoManager::Instance().IsClosed())
+    {
+        auto& abbox = vecgeom::ABBoxManager::Instance();
+        for (auto const* lv : mothers)
+        {
+            abbox.InitABBoxes(lv);
+        }
+        vecgeom::BVHManager::Init();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply alignment corrections to the nominal Geant4 transforms.
+ *
+ * Only the transforms of the corrected placements are changed: shapes and
+ * logical volumes are reused as they are. The converted navigation tables,
+ * placement table, compact transforms, and touchable transforms are
+ * refreshed, as are the VecGeom bounding boxes of the affected mothers if
+ * the geometry is closed. VecGeom rebuilds its BVH only as a whole, so that
+ * is redone for every volume. Applying the same corrections twice gives the
+ * same geometry.
+ *
+ * This modifies the VecGeom volumes in place, so nothing may navigate the
+ * geometry during the update. Placements are matched to their Geant4 volumes
+ * by mother, daughter volume, copy number, and name: replicated and
+ * parameterised volumes, and placements that cannot be told apart from a
+ * sibling, cannot be aligned.
+ */
+AlignmentResult apply_alignment(Converted* converted,
+                                std::vector<AlignmentDelta> const& deltas)
+{
+    std::vector<Update> updates;
+    updates.reserve(deltas.size());
+    for (auto const& d : deltas)
+    {
+        if (!d.placement)
+        {
+            throw std::invalid_argument("cannot align a null placement");
+        }
+        updates.emplace_back(d.placement,
+                             object_transform(*d.placement) * d.delta);
+    }
+    return align(converted, updates);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Update placements to the current transforms of their Geant4 volumes.
+ *
+ * This is for alignments applied directly to the Geant4 geometry (e.g. with
+ * \c G4VPhysicalVolume::SetTranslation ), and otherwise behaves like
+ * \c apply_alignment .
+ */
+AlignmentResult
+update_placements(Converted* converted,
+                  std::vector<G4VPhysicalVolume const*> const& placements)
+{
+    std::vector<Update> updates;
+    updates.reserve(placements.size());
+    for (auto const* pv : placements)
+    {
+        if (!pv)
+        {
+            throw std::invalid_argument("cannot align a null placement");
+        }
+        updates.emplace_back(pv, object_transform(*pv));
+    }
+    return align(converted, updates);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Alignment.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <G4Transform3D.hh>
+
+#include "G4VG.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Alignment correction for one Geant4 placement.
+ *
+ * The correction is applied in the placement's local frame, after its
+ * nominal Geant4 transform: the aligned object transform is
+ * <code>nominal * delta</code>. The Geant4 volume itself is not modified.
+ */
+struct AlignmentDelta
+{
+    G4VPhysicalVolume const* placement{nullptr};
+    G4Transform3D delta;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of entries updated by an alignment.
+ */
+struct AlignmentResult
+{
+    std::size_t placements{0};  //!< VecGeom placements moved
+    std::size_t mothers{0};  //!< Logical volumes with moved daughters
+    std::size_t touchables{0};  //!< Touchable transform rows recomputed
+};
+
+//---------------------------------------------------------------------------//
+// Apply alignment corrections to the nominal Geant4 transforms
+AlignmentResult apply_alignment(Converted* converted,
+                                std::vector<AlignmentDelta> const& deltas);
+
+// Update placements to the current transforms of their Geant4 volumes
+AlignmentResult
+update_placements(Converted* converted,
+                  std::vector<G4VPhysicalVolume const*> const& placements);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
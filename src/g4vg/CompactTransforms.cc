@@ -0,0 +1,184 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/CompactTransforms.cc
+//---------------------------------------------------------------------------//
+#include "CompactTransforms.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "VolumeIds.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Encode all placements reachable from the world.
+ *
+ * Rotations are deduplicated by exact value.
+ */
+CompactTransforms::CompactTransforms(VolumeIds const& ids,
+                                     Options const& options)
+{
+    auto const num_placements = ids.num_placements();
+    rotation_ids_.assign(num_placements, no_rotation);
+    double_trans_.assign(3 * num_placements, 0.0);
+
+    std::map<Rotation, unsigned int> rotation_ids;
+    for (unsigned int id = 0; id != num_placements; ++id)
+    {
+        auto const* xf = ids.placement(id)->GetTransformation();
+        for (int i = 0; i < 3; ++i)
+        {
+            double_trans_[3 * id + i] = xf->Translation(i);
+        }
+        if (xf->HasRotation())
+        {
+            Rotation rot;
+            for (int i = 0; i < 9; ++i)
+            {
+                rot[i] = xf->Rotation(i);
+            }
+            auto [iter, inserted] = rotation_ids.insert(
+                {rot, static_cast<unsigned int>(rotations_.size())});
+            if (inserted)
+            {
+                rotations_.push_back(rot);
+            }
+            rotation_ids_[id] = iter->second;
+        }
+    }
+
+    if (options.float_translations)
+    {
+        std::vector<float> trans(double_trans_.size());
+        double max_error = 0;
+        for (std::size_t i = 0; i != trans.size(); ++i)
+        {
+            trans[i] = static_cast<float>(double_trans_[i]);
+            max_error = std::max(
+                max_error, std::fabs(double_trans_[i] - double(trans[i])));
+        }
+        if (max_error <= options.max_translation_error)
+        {
+            float_trans_ = std::move(trans);
+            std::vector<double>{}.swap(double_trans_);
+            max_error_ = max_error;
+            max_allowed_error_ = options.max_translation_error;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transform a point from the mother frame to the placement's frame.
+ *
+ * This is equivalent to \c vecgeom::Transformation3D::Transform .
+ */
+auto CompactTransforms::to_local(unsigned int pv, Real3 const& pos) const
+    -> Real3
+{
+    Real3 const t = this->translation(pv);
+    Real3 const p{pos[0] - t[0], pos[1] - t[1], pos[2] - t[2]};
+    if (rotation_ids_[pv] == no_rotation)
+    {
+        return p;
+    }
+    Rotation const& r = rotations_[rotation_ids_[pv]];
+    return {r[0] * p[0] + r[3] * p[1] + r[6] * p[2],
+            r[1] * p[0] + r[4] * p[1] + r[7] * p[2],
+            r[2] * p[0] + r[5] * p[1] + r[8] * p[2]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Re-encode a placement from its current transform.
+ *
+ * A new rotation is appended to the table of unique rotations. If the new
+ * translation cannot be stored in single precision within the original error
+ * bound, all translations are converted to double precision.
+ */
+void CompactTransforms::update(unsigned int id,
+                               vecgeom::VPlacedVolume const& pv)
+{
+    if (id >= rotation_ids_.size())
+    {
+        throw std::out_of_range("placement was not encoded");
+    }
+
+    auto const* xf = pv.GetTransformation();
+    rotation_ids_[id] = no_rotation;
+    if (xf->HasRotation())
+    {
+        Rotation rot;
+        for (int i = 0; i < 9; ++i)
+        {
+            rot[i] = xf->Rotation(i);
+        }
+        auto iter = std::find(rotations_.begin(), rotations_.end(), rot);
+        rotation_ids_[id]
+            = static_cast<unsigned int>(iter - rotations_.begin());
+        if (iter == rotations_.end())
+        {
+            rotations_.push_back(rot);
+        }
+    }
+
+    if (!float_trans_.empty())
+    {
+        float trans[3];
+        double error = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            trans[i] = static_cast<float>(xf->Translation(i));
+            error = std::max(error,
+                             std::fabs(xf->Translation(i) - double(trans[i])));
+        }
+        if (error <= max_allowed_error_)
+        {
+            std::copy(trans, trans + 3, float_trans_.begin() + 3 * id);
+            max_error_ = std::max(max_error_, error);
+            return;
+        }
+        double_trans_.assign(float_trans_.begin(), float_trans_.end());
+        std::vector<float>{}.swap(float_trans_);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        double_trans_[3 * id + i] = xf->Translation(i);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Heap memory used by the encoding.
+ */
+std::size_t CompactTransforms::memory_bytes() const
+{
+    return rotation_ids_.capacity() * sizeof(unsigned int)
+           + rotations_.capacity() * sizeof(Rotation)
+           + double_trans_.capacity() * sizeof(double)
+           + float_trans_.capacity() * sizeof(float);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release excess capacity.
+ */
+void CompactTransforms::shrink_to_fit()
+{
+    rotation_ids_.shrink_to_fit();
+    rotations_.shrink_to_fit();
+    double_trans_.shrink_to_fit();
+    float_trans_.shrink_to_fit();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,142 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/CompactTransforms.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace vecgeom
+{
+inline namespace cxx
+{
+class VPlacedVolume;
+}  // namespace cxx
+}  // namespace vecgeom
+
+namespace g4vg
+{
+class VolumeIds;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compact encoding of all placement transforms, indexed by placement ID.
+ *
+ * Each placement stores only an index into a table of unique rotations
+ * (\c no_rotation if it has none) and a translation. Most detectors use a
+ * small set of rotations, so the 9 rotation doubles per placement collapse to
+ * a single integer. Translations can optionally be stored in single precision
+ * if the rounding error for every placement is below a given bound;
+ * otherwise they are kept in double precision.
+ *
+ * Rotations are stored in the same element order as
+ * \c vecgeom::Transformation3D::Rotation .
+ */
+class CompactTransforms
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Real3 = std::array<double, 3>;
+    using Rotation = std::array<double, 9>;
+    //!@}
+
+    //! Rotation index for a translation-only placement
+    static constexpr unsigned int no_rotation = static_cast<unsigned int>(-1);
+
+    //! Construction options
+    struct Options
+    {
+        //! Store translations in single precision if possible
+        bool float_translations{false};
+        //! Maximum absolute rounding error for single precision [length]
+        double max_translation_error{1e-6};
+    };
+
+  public:
+    // Construct empty
+    CompactTransforms() = default;
+
+    // Encode all placements reachable from the world
+    CompactTransforms(VolumeIds const& ids, Options const& options);
+
+    //! Number of placements
+    std::size_t size() const { return rotation_ids_.size(); }
+
+    //! Whether no placements are stored
+    bool empty() const { return rotation_ids_.empty(); }
+
+    //! Whether translations are stored in single precision
+    bool float_translations() const { return !float_trans_.empty(); }
+
+    //! Largest rounding error of the stored translations
+    double max_translation_error() const { return max_error_; }
+
+    //! Number of unique rotations
+    std::size_t num_rotations() const { return rotations_.size(); }
+
+    //! Index of a placement's rotation, or \c no_rotation
+    unsigned int rotation_id(unsigned int pv) const
+    {
+        return rotation_ids_[pv];
+    }
+
+    //! Get a unique rotation
+    Rotation const& rotation(unsigned int id) const { return rotations_[id]; }
+
+    //! Whether the placement is the identity transform
+    bool is_identity(unsigned int pv) const
+    {
+        auto t = this->translation(pv);
+        return rotation_ids_[pv] == no_rotation && t[0] == 0 && t[1] == 0
+               && t[2] == 0;
+    }
+
+    // Get the translation of a placement
+    inline Real3 translation(unsigned int pv) const;
+
+    // Transform a point from the mother frame to the placement's frame
+    Real3 to_local(unsigned int pv, Real3 const& pos) const;
+
+    // Re-encode a placement from its current transform
+    void update(unsigned int id, vecgeom::VPlacedVolume const& pv);
+
+    // Heap memory used by the encoding
+    std::size_t memory_bytes() const;
+
+    // Release excess capacity
+    void shrink_to_fit();
+
+  private:
+    std::vector<unsigned int> rotation_ids_;
+    std::vector<Rotation> rotations_;
+    std::vector<double> double_trans_;
+    std::vector<float> float_trans_;
+    double max_error_{0};
+    double max_allowed_error_{0};
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get the translation of a placement.
+ */
+auto CompactTransforms::translation(unsigned int pv) const -> Real3
+{
+    if (!float_trans_.empty())
+    {
+        float const* t = float_trans_.data() + 3 * pv;
+        return {t[0], t[1], t[2]};
+    }
+    double const* t = double_trans_.data() + 3 * pv;
+    return {t[0], t[1], t[2]};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
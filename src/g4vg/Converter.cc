@@ -0,0 +1,390 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Converter.cc
+//---------------------------------------------------------------------------//
+#include "Converter.hh"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <G4LogicalVolume.hh>
+#include <G4ReplicaNavigation.hh>
+#include <G4VPVParameterisation.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+#include <VecGeom/volumes/UnplacedVolume.h>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Make a unique VecGeom label from a Geant4 logical volume.
+ *
+ * GDML-stripped names may be duplicated, so the address is appended in the
+ * same format as unstripped GDML names.
+ */
+std::string make_label(G4LogicalVolume const& lv)
+{
+    std::ostringstream os;
+    os << lv.GetName() << "0x" << std::hex
+       << reinterpret_cast<std::uintptr_t>(&lv);
+    return os.str();
+}
+
+//---------------------------------------------------------------------------//
+//! Describe a solid's type and dimensions
+std::string describe(G4VSolid const& solid)
+{
+    std::ostringstream os;
+    solid.StreamInfo(os);
+    return os.str();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the transform of a Geant4 physical volume when leaving scope.
+ *
+ * Replica navigation rotates the volume's own rotation matrix in place, so
+ * its value is saved as well as the pointer.
+ */
+class ScopedTransform
+{
+  public:
+    explicit ScopedTransform(G4VPhysicalVolume& pv)
+        : pv_{pv}
+        , translation_{pv.GetTranslation()}
+        , rotation_{pv.GetRotation()}
+    {
+        if (rotation_)
+        {
+            rotation_value_ = *rotation_;
+        }
+    }
+
+    ~ScopedTransform()
+    {
+        if (rotation_)
+        {
+            *rotation_ = rotation_value_;
+        }
+        pv_.SetRotation(rotation_);
+        pv_.SetTranslation(translation_);
+    }
+
+    //!@{
+    //! Prevent copying and moving
+    ScopedTransform(ScopedTransform const&) = delete;
+    ScopedTransform& operator=(ScopedTransform const&) = delete;
+    //!@}
+
+  private:
+    G4VPhysicalVolume& pv_;
+    G4ThreeVector translation_;
+    G4RotationMatrix* rotation_;
+    G4RotationMatrix rotation_value_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with options.
+ */
+Converter::Converter(Options const& options)
+    : options_{options}
+    , transform_{options.scale}
+    , convert_solid_{options.scale, options.wrap_unsupported, &store_}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the world.
+ *
+ * The returned world is placed but not registered with the geometry
+ * manager: that is left to the caller. The converter should not be reused.
+ */
+auto Converter::operator()(G4VPhysicalVolume const* g4world) -> result_type
+{
+    if (!g4world)
+    {
+        throw std::invalid_argument("cannot convert a null world volume");
+    }
+    if (options_.daughter_order == DaughterOrder::profile
+        && !options_.profile)
+    {
+        throw std::invalid_argument(
+            "profile daughter ordering requires a navigation profile");
+    }
+
+    G4LogicalVolume const* g4lv = g4world->GetLogicalVolume();
+    auto* vglv = this->build_with_daughters(g4lv);
+
+    auto const xf = transform_(object_transform(*g4world)
+                               * unwrap_solid(*g4lv->GetSolid()).transform);
+
+    std::string label;
+    if (options_.vecgeom_names)
+    {
+        label = g4world->GetName();
+    }
+    result_type result;
+    result.world = vglv->Place(label.c_str(), &xf);
+    store_.insert(result.world);
+    result.volumes.insert(built_.begin(), built_.end());
+    result.daughter_slots = std::move(slots_);
+    result.wrapped = convert_solid_.wrapped();
+    result.store = std::move(store_);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a volume, its daughters, and their placements.
+ *
+ * Daughter volumes are converted before the mother.
+ */
+auto Converter::build_with_daughters(G4LogicalVolume const* mother_g4lv)
+    -> VGLogicalVolume*
+{
+    auto iter = built_.find(mother_g4lv);
+    if (iter != built_.end())
+    {
+        return iter->second;
+    }
+
+    auto const num_daughters = mother_g4lv->GetNoDaughters();
+    for (std::size_t i = 0; i != num_daughters; ++i)
+    {
+        this->build_with_daughters(
+            mother_g4lv->GetDaughter(i)->GetLogicalVolume());
+    }
+
+    auto* mother = this->build(*mother_g4lv);
+    auto const mother_inverse
+        = unwrap_solid(*mother_g4lv->GetSolid()).transform.inverse();
+    VecCopy copies;
+    for (std::size_t i = 0; i != num_daughters; ++i)
+    {
+        this->add_copies(
+            *mother_g4lv->GetDaughter(i), mother_inverse, &copies);
+    }
+    this->place_copies(copies, mother);
+
+    built_.insert({mother_g4lv, mother});
+    return mother;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a single logical volume without its daughters.
+ *
+ * The volume is unlabeled if VecGeom names are disabled.
+ */
+auto Converter::build(G4LogicalVolume const& g4lv) -> VGLogicalVolume*
+{
+    auto const* shape = convert_solid_(*g4lv.GetSolid());
+    std::string const label = options_.vecgeom_names ? make_label(g4lv)
+                                                     : std::string{};
+    auto* result = new VGLogicalVolume(label.c_str(), shape);
+    store_.insert(result);
+
+    if (options_.verbose)
+    {
+        std::clog << "g4vg: converted logical volume '" << g4lv.GetName()
+                  << "' to ID " << result->id() << std::endl;
+    }
+    if (options_.compare_volumes)
+    {
+        this->check_volume(g4lv, *result);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the transform of every copy of a daughter.
+ *
+ * Replicas and parameterisations are expanded by updating the Geant4
+ * physical volume for each copy in turn, as the Geant4 navigator does, and
+ * its original transform is restored afterward. All copies share the shape
+ * of the daughter's logical volume, so a parameterisation that changes the
+ * solid or its dimensions is an error.
+ */
+void Converter::add_copies(G4VPhysicalVolume const& g4pv,
+                           G4Transform3D const& mother_inverse,
+                           VecCopy* copies)
+{
+    G4LogicalVolume const* g4lv = g4pv.GetLogicalVolume();
+    auto iter = built_.find(g4lv);
+    if (iter == built_.end())
+    {
+        throw std::logic_error("daughter '" + g4lv->GetName()
+                               + "' was not converted before its mother");
+    }
+    VGLogicalVolume const* daughter = iter->second;
+    auto const daughter_xf = unwrap_solid(*g4lv->GetSolid()).transform;
+
+    auto add_copy = [&](int copy_no) {
+        copies->push_back({&g4pv,
+                           daughter,
+                           copy_no,
+                           transform_(mother_inverse * object_transform(g4pv)
+                                      * daughter_xf)});
+    };
+
+    if (!g4pv.IsReplicated())
+    {
+        add_copy(g4pv.GetCopyNo());
+        return;
+    }
+
+    // Computing a copy's transform modifies the physical volume
+    auto& mutable_pv = const_cast<G4VPhysicalVolume&>(g4pv);
+    ScopedTransform restore_transform{mutable_pv};
+    G4VPVParameterisation* param = g4pv.GetParameterisation();
+    std::string const dimensions
+        = param ? describe(*g4lv->GetSolid()) : std::string{};
+    G4ReplicaNavigation replica_nav;
+    for (int copy_no = 0; copy_no != g4pv.GetMultiplicity(); ++copy_no)
+    {
+        if (param)
+        {
+            param->ComputeTransformation(copy_no, &mutable_pv);
+
+            // The converted shape must match every copy
+            G4VSolid* solid = param->ComputeSolid(copy_no, &mutable_pv);
+            if (solid != g4lv->GetSolid())
+            {
+                throw std::runtime_error(
+                    "parameterisation of '" + g4pv.GetName()
+                    + "' changes the solid of copy " + std::to_string(copy_no)
+                    + ", which is not supported");
+            }
+            solid->ComputeDimensions(param, copy_no, &mutable_pv);
+            if (describe(*solid) != dimensions)
+            {
+                throw std::runtime_error(
+                    "parameterisation of '" + g4pv.GetName()
+                    + "' changes the dimensions of copy "
+                    + std::to_string(copy_no) + ", which is not supported");
+            }
+        }
+        else
+        {
+            replica_nav.ComputeTransformation(copy_no, &mutable_pv);
+        }
+        add_copy(copy_no);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Place daughter copies in their mother in the daughter order.
+ *
+ * Sorting is stable, so ties keep the Geant4 order. Unless the Geant4 order
+ * is kept, the index of each copy in the Geant4 daughter list (with replicas
+ * expanded) is saved for the placement.
+ */
+void Converter::place_copies(VecCopy const& copies, VGLogicalVolume* mother)
+{
+    std::vector<std::size_t> order(copies.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    bool const reorder = options_.daughter_order != DaughterOrder::geant4;
+    if (reorder && copies.size() > 1)
+    {
+        auto const keys = this->sort_keys(copies);
+        std::stable_sort(order.begin(), order.end(), [&keys](auto a, auto b) {
+            return keys[a] < keys[b];
+        });
+    }
+
+    for (auto slot : order)
+    {
+        Copy const& copy = copies[slot];
+        std::string label;
+        if (options_.vecgeom_names)
+        {
+            label = copy.g4pv->GetName();
+        }
+        auto* vgpv = copy.daughter->Place(label.c_str(), &copy.transform);
+        store_.insert(vgpv);
+        vgpv->SetCopyNo(copy.copy_no);
+        mother->PlaceDaughter(vgpv);
+        if (reorder)
+        {
+            slots_.insert({vgpv, static_cast<unsigned int>(slot)});
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate keys for sorting the copies of a mother's daughters.
+ *
+ * Morton keys use the bounding box center of each copy in the mother's frame.
+ * Profile keys sort placements with more entries first.
+ */
+std::vector<std::uint64_t> Converter::sort_keys(VecCopy const& copies) const
+{
+    std::vector<std::uint64_t> result;
+    if (options_.daughter_order == DaughterOrder::profile)
+    {
+        result.reserve(copies.size());
+        for (auto const& copy : copies)
+        {
+            result.push_back(
+                ~options_.profile->count(copy.g4pv->GetName(), copy.copy_no));
+        }
+        return result;
+    }
+
+    std::vector<std::array<double, 3>> centers;
+    centers.reserve(copies.size());
+    for (auto const& copy : copies)
+    {
+        vecgeom::Vector3D<vecgeom::Precision> lower;
+        vecgeom::Vector3D<vecgeom::Precision> upper;
+        copy.daughter->GetUnplacedVolume()->Extent(lower, upper);
+        auto const center
+            = copy.transform.InverseTransform((lower + upper) / 2.0);
+        centers.push_back({center[0], center[1], center[2]});
+    }
+    return morton_keys(centers);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Warn if the capacity of a converted volume differs from Geant4's.
+ */
+void Converter::check_volume(G4LogicalVolume const& g4lv,
+                             VGLogicalVolume const& vglv) const
+{
+    double const g4_capacity = g4lv.GetSolid()->GetCubicVolume()
+                               * std::pow(options_.scale, 3);
+    double const vg_capacity = vglv.GetUnplacedVolume()->Capacity();
+    if (std::fabs(vg_capacity - g4_capacity) > 0.01 * std::fabs(g4_capacity))
+    {
+        std::clog << "g4vg: warning: volume of '" << g4lv.GetName()
+                  << "' differs: Geant4 " << g4_capacity << ", VecGeom "
+                  << vg_capacity << std::endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,118 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Converter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "DaughterOrder.hh"
+#include "SolidConverter.hh"
+#include "Transformer.hh"
+#include "VolumeStore.hh"
+
+class G4LogicalVolume;
+class G4VPhysicalVolume;
+
+namespace vecgeom
+{
+inline namespace cxx
+{
+class LogicalVolume;
+class VPlacedVolume;
+}  // namespace cxx
+}  // namespace vecgeom
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Create VecGeom volumes from a Geant4 world volume.
+ *
+ * This builds the VecGeom logical volume hierarchy in post-order (daughters
+ * before their mothers), which is also the order of \c VolumeIds . Each
+ * Geant4 logical volume is converted exactly once. Replicated and
+ * parameterised placements are expanded into one VecGeom placement per copy;
+ * parameterisations that change the solid or its dimensions are rejected.
+ * The copies of each volume's daughters are sorted by the daughter order
+ * before they are placed.
+ * Every VecGeom object created is owned by the returned \c VolumeStore (or
+ * deleted with the converter if conversion fails).
+ */
+class Converter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VGLogicalVolume = vecgeom::LogicalVolume;
+    using VGPlacedVolume = vecgeom::VPlacedVolume;
+    using MapLvVolume
+        = std::unordered_map<G4LogicalVolume const*, VGLogicalVolume const*>;
+    using MapPvSlot = std::unordered_map<VGPlacedVolume const*, unsigned int>;
+    //!@}
+
+    //! Configuration for conversion
+    struct Options
+    {
+        bool verbose{false};
+        bool compare_volumes{false};
+        bool wrap_unsupported{false};
+        bool vecgeom_names{true};
+        double scale{1};
+        DaughterOrder daughter_order{DaughterOrder::geant4};
+        NavigationProfile const* profile{nullptr};
+    };
+
+    //! Result of conversion
+    struct result_type
+    {
+        VGPlacedVolume* world{nullptr};
+        MapLvVolume volumes;
+        MapPvSlot daughter_slots;
+        SolidConverter::VecWrapped wrapped;
+        VolumeStore store;
+    };
+
+  public:
+    // Construct with options
+    explicit Converter(Options const& options);
+
+    // Convert the world
+    result_type operator()(G4VPhysicalVolume const* g4world);
+
+  private:
+    //! Copy of a daughter to be placed
+    struct Copy
+    {
+        G4VPhysicalVolume const* g4pv{nullptr};
+        VGLogicalVolume const* daughter{nullptr};
+        int copy_no{0};
+        vecgeom::Transformation3D transform;
+    };
+    using VecCopy = std::vector<Copy>;
+
+    Options options_;
+    Transformer transform_;
+    VolumeStore store_;
+    SolidConverter convert_solid_;
+    std::unordered_map<G4LogicalVolume const*, VGLogicalVolume*> built_;
+    MapPvSlot slots_;
+
+    VGLogicalVolume* build_with_daughters(G4LogicalVolume const* mother_g4lv);
+    VGLogicalVolume* build(G4LogicalVolume const& g4lv);
+    void add_copies(G4VPhysicalVolume const& g4pv,
+                    G4Transform3D const& mother_inverse,
+                    VecCopy* copies);
+    void place_copies(VecCopy const& copies, VGLogicalVolume* mother);
+    std::vector<std::uint64_t> sort_keys(VecCopy const& copies) const;
+    void check_volume(G4LogicalVolume const& g4lv,
+                      VGLogicalVolume const& vglv) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,143 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/DaughterOrder.cc
+//---------------------------------------------------------------------------//
+#include "DaughterOrder.hh"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Bits per axis in a 64-bit Morton code
+constexpr int morton_bits = 21;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Spread the low 21 bits of an integer so there are two zeros between each.
+ */
+std::uint64_t spread_bits(std::uint64_t v)
+{
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffffull;
+    v = (v | v << 16) & 0x1f0000ff0000ffull;
+    v = (v | v << 8) & 0x100f00f00f00f00full;
+    v = (v | v << 4) & 0x10c30c30c30c30c3ull;
+    v = (v | v << 2) & 0x1249249249249249ull;
+    return v;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read from a text stream.
+ */
+NavigationProfile NavigationProfile::from_stream(std::istream& is)
+{
+    NavigationProfile result;
+    std::string line;
+    int line_no = 0;
+    while (std::getline(is, line))
+    {
+        ++line_no;
+        std::istringstream ss{line};
+        std::string name;
+        if (!(ss >> name) || name.front() == '#')
+        {
+            continue;
+        }
+        int copy{};
+        unsigned long long count{};
+        if (!(ss >> copy >> count))
+        {
+            throw std::runtime_error("invalid navigation profile on line "
+                                     + std::to_string(line_no) + ": '"
+                                     + line + "'");
+        }
+        result.add(name, copy, count);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of entries for a placement (zero if absent).
+ */
+unsigned long long
+NavigationProfile::count(std::string const& name, int copy) const
+{
+    auto iter = counts_.find({name, copy});
+    return iter != counts_.end() ? iter->second : 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write in the text format.
+ */
+void NavigationProfile::write(std::ostream& os) const
+{
+    os << "# name copy count\n";
+    for (auto&& [key, count] : counts_)
+    {
+        os << key.first << ' ' << key.second << ' ' << count << '\n';
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate Morton codes of points normalized to their bounding box.
+ *
+ * Sorting by the codes orders the points along a Z-order curve. Points are
+ * scaled independently along each axis, so a flat layout still uses all the
+ * bits of the other axes.
+ */
+std::vector<std::uint64_t>
+morton_keys(std::vector<std::array<double, 3>> const& points)
+{
+    std::vector<std::uint64_t> result;
+    if (points.empty())
+    {
+        return result;
+    }
+
+    auto lower = points.front();
+    auto upper = points.front();
+    for (auto const& p : points)
+    {
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            lower[ax] = std::min(lower[ax], p[ax]);
+            upper[ax] = std::max(upper[ax], p[ax]);
+        }
+    }
+
+    constexpr double max_int = (1 << morton_bits) - 1;
+    result.reserve(points.size());
+    for (auto const& p : points)
+    {
+        std::uint64_t key = 0;
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            double const width = upper[ax] - lower[ax];
+            double const frac = width > 0 ? (p[ax] - lower[ax]) / width : 0;
+            key |= spread_bits(static_cast<std::uint64_t>(frac * max_int))
+                   << ax;
+        }
+        result.push_back(key);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/DaughterOrder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Order in which the daughters of each converted volume are stored.
+ *
+ * The converter sorts the copies of each volume's daughters before placing
+ * them, so the daughter lists are built in their final order.
+ *
+ * - \c geant4 keeps the order of the Geant4 daughters.
+ * - \c morton sorts daughters along a Morton (Z-order) space-filling curve
+ *   through their bounding box centers, so that spatially neighboring
+ *   placements are adjacent in memory.
+ * - \c profile sorts daughters by decreasing entry count from a
+ *   \c NavigationProfile , so that linear daughter searches test the most
+ *   frequently entered placements first.
+ */
+enum class DaughterOrder
+{
+    geant4,
+    morton,
+    profile,
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of times each placement was entered during a representative run.
+ *
+ * Placements are identified by their Geant4 physical volume name and copy
+ * number (replica number for replicated and parameterised volumes), which are
+ * stable between runs. The text format has one placement per line:
+ * \verbatim
+   # name copy count
+   CaloCell 12 104553
+   Tracker 0 2871
+   \endverbatim
+ * Blank lines and lines starting with \c # are ignored. Names may not
+ * contain whitespace.
+ */
+class NavigationProfile
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Key = std::pair<std::string, int>;
+    using MapCount = std::map<Key, unsigned long long>;
+    //!@}
+
+  public:
+    // Read from a text stream
+    static NavigationProfile from_stream(std::istream& is);
+
+    //! Add entries for a placement
+    void add(std::string const& name, int copy, unsigned long long count)
+    {
+        counts_[{name, copy}] += count;
+    }
+
+    // Number of entries for a placement (zero if absent)
+    unsigned long long count(std::string const& name, int copy) const;
+
+    // Write in the text format
+    void write(std::ostream& os) const;
+
+    //! Access all counts
+    MapCount const& counts() const { return counts_; }
+
+  private:
+    MapCount counts_;
+};
+
+//---------------------------------------------------------------------------//
+// Calculate Morton codes of points normalized to their bounding box
+std::vector<std::uint64_t>
+morton_keys(std::vector<std::array<double, 3>> const& points);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
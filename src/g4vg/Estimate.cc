@@ -0,0 +1,379 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Estimate.cc
+//---------------------------------------------------------------------------//
+#include "Estimate.hh"
+
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <G4BooleanSolid.hh>
+#include <G4DisplacedSolid.hh>
+#include <G4GenericPolycone.hh>
+#include <G4LogicalVolume.hh>
+#include <G4MultiUnion.hh>
+#include <G4Polycone.hh>
+#include <G4Polyhedra.hh>
+#include <G4ReflectedSolid.hh>
+#include <G4ScaledSolid.hh>
+#include <G4TessellatedSolid.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <VecGeom/base/Transformation3D.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// COST MODEL
+//---------------------------------------------------------------------------//
+/*!
+ * Approximate cost of converting one shape.
+ *
+ * Bytes include the VecGeom unplaced shape and its share of specialized
+ * placed volume code; seconds are single-threaded construction time on a
+ * current x86 core. These are orders of magnitude and should be updated
+ * when the converter or VecGeom changes significantly.
+ */
+struct ShapeCost
+{
+    char const* type;
+    double bytes;
+    double seconds;
+};
+
+constexpr ShapeCost shape_costs[] = {
+    {"G4Box", 150, 2e-6},
+    {"G4Cons", 300, 3e-6},
+    {"G4CutTubs", 350, 4e-6},
+    {"G4Ellipsoid", 300, 3e-6},
+    {"G4EllipticalCone", 250, 3e-6},
+    {"G4EllipticalTube", 250, 3e-6},
+    {"G4ExtrudedSolid", 2000, 5e-5},
+    {"G4GenericPolycone", 1000, 2e-5},
+    {"G4GenericTrap", 800, 1e-5},
+    {"G4Hype", 300, 3e-6},
+    {"G4IntersectionSolid", 150, 2e-6},
+    {"G4Orb", 120, 2e-6},
+    {"G4Para", 250, 3e-6},
+    {"G4Paraboloid", 250, 3e-6},
+    {"G4Polycone", 1000, 2e-5},
+    {"G4Polyhedra", 1500, 3e-5},
+    {"G4Sphere", 400, 4e-6},
+    {"G4SubtractionSolid", 150, 2e-6},
+    {"G4TessellatedSolid", 1000, 2e-5},
+    {"G4Tet", 400, 4e-6},
+    {"G4Torus", 300, 4e-6},
+    {"G4Trap", 500, 5e-6},
+    {"G4Trd", 200, 2e-6},
+    {"G4Tubs", 250, 3e-6},
+    {"G4UnionSolid", 150, 2e-6},
+};
+
+//! Cost of shapes not in the table
+constexpr ShapeCost default_shape_cost{"", 500, 1e-5};
+
+//! Additional cost per polygon corner or facet
+constexpr ShapeCost vertex_cost{"", 150, 2e-6};
+
+//! Cost of each logical and placed volume, excluding its shape
+constexpr double volume_seconds = 2e-6;
+constexpr double placement_seconds = 1e-6;
+constexpr std::size_t volume_bytes = sizeof(vecgeom::LogicalVolume);
+constexpr std::size_t placement_bytes = sizeof(vecgeom::VPlacedVolume)
+                                        + sizeof(vecgeom::Transformation3D);
+
+//! Cost of building each entry in a conversion table
+constexpr double table_entry_seconds = 5e-8;
+
+//---------------------------------------------------------------------------//
+ShapeCost const& find_cost(G4VSolid const& solid)
+{
+    auto const type = solid.GetEntityType();
+    for (auto const& cost : shape_costs)
+    {
+        if (type == cost.type)
+        {
+            return cost;
+        }
+    }
+    return default_shape_cost;
+}
+
+//---------------------------------------------------------------------------//
+//! Number of polygon corners or facets that scale a shape's cost
+int count_vertices(G4VSolid const& solid)
+{
+    if (auto* s = dynamic_cast<G4Polycone const*>(&solid))
+    {
+        return s->GetNumRZCorner();
+    }
+    if (auto* s = dynamic_cast<G4GenericPolycone const*>(&solid))
+    {
+        return s->GetNumRZCorner();
+    }
+    if (auto* s = dynamic_cast<G4Polyhedra const*>(&solid))
+    {
+        return s->GetNumRZCorner();
+    }
+    if (auto* s = dynamic_cast<G4TessellatedSolid const*>(&solid))
+    {
+        return s->GetNumberOfFacets();
+    }
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Traverse the Geant4 tree once, counting what the converter would create.
+ */
+class Estimator
+{
+  public:
+    explicit Estimator(std::vector<G4LogicalVolume const*> const& selected)
+        : selected_(selected.begin(), selected.end())
+    {
+    }
+
+    //! Number of touchables below a volume, and of selected ones
+    struct Paths
+    {
+        double all{0};
+        double selected{0};
+    };
+
+    Paths visit(G4LogicalVolume const* lv);
+    void add_solid(G4VSolid const* solid);
+
+    ConversionEstimate result;
+    std::unordered_map<G4LogicalVolume const*, Paths> volumes;
+
+  private:
+    std::unordered_set<G4LogicalVolume const*> selected_;
+    std::unordered_set<G4VSolid const*> solids_;
+
+    void add_shape_cost(G4VSolid const& solid, double count);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count a logical volume and (once) everything below it.
+ *
+ * Each volume is converted once regardless of how often it is placed, but
+ * its touchables are multiplied by the number of paths leading to it.
+ */
+auto Estimator::visit(G4LogicalVolume const* lv) -> Paths
+{
+    auto iter = volumes.find(lv);
+    if (iter != volumes.end())
+    {
+        return iter->second;
+    }
+
+    result.logical_volumes += 1;
+    result.vecgeom_bytes += volume_bytes;
+    result.seconds += volume_seconds;
+    this->add_solid(lv->GetSolid());
+
+    Paths paths;
+    paths.all = 1;
+    paths.selected = selected_.count(lv);
+    for (std::size_t i = 0; i != lv->GetNoDaughters(); ++i)
+    {
+        auto const* pv = lv->GetDaughter(i);
+        auto const copies = pv->GetMultiplicity();
+        // Parameterised copies share the shape of their logical volume
+        result.placed_volumes += copies;
+        result.vecgeom_bytes += copies * placement_bytes;
+        result.seconds += copies * placement_seconds;
+
+        Paths const d = this->visit(pv->GetLogicalVolume());
+        paths.all += copies * d.all;
+        paths.selected += copies * d.selected;
+    }
+    volumes.insert({lv, paths});
+    return paths;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count a shape, plus helper volumes for boolean, scaled, and multi-union
+ * constituents.
+ *
+ * Displacements and reflections are folded into the constituent placement
+ * by the converter, so they add no shapes of their own.
+ */
+void Estimator::add_solid(G4VSolid const* solid)
+{
+    while (true)
+    {
+        if (auto* disp = dynamic_cast<G4DisplacedSolid const*>(solid))
+        {
+            solid = disp->GetConstituentMovedSolid();
+        }
+        else if (auto* refl = dynamic_cast<G4ReflectedSolid const*>(solid))
+        {
+            solid = refl->GetConstituentMovedSolid();
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (!solids_.insert(solid).second)
+    {
+        return;
+    }
+
+    result.solids += 1;
+    this->add_shape_cost(*solid, 1);
+
+    auto add_helper = [this](G4VSolid const* constituent) {
+        // Each constituent becomes a placed helper volume
+        result.logical_volumes += 1;
+        result.placed_volumes += 1;
+        result.vecgeom_bytes += volume_bytes + placement_bytes;
+        this->add_solid(constituent);
+    };
+    if (auto* boolean = dynamic_cast<G4BooleanSolid const*>(solid))
+    {
+        add_helper(boolean->GetConstituentSolid(0));
+        add_helper(boolean->GetConstituentSolid(1));
+    }
+    else if (auto* scaled = dynamic_cast<G4ScaledSolid const*>(solid))
+    {
+        add_helper(scaled->GetUnscaledSolid());
+    }
+    else if (auto* multi = dynamic_cast<G4MultiUnion const*>(solid))
+    {
+        for (int i = 0; i != multi->GetNumberOfSolids(); ++i)
+        {
+            add_helper(multi->GetSolid(i));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void Estimator::add_shape_cost(G4VSolid const& solid, double count)
+{
+    auto const& cost = find_cost(solid);
+    double const vertices = count_vertices(solid);
+    result.vecgeom_bytes += static_cast<std::size_t>(
+        count * (cost.bytes + vertices * vertex_cost.bytes));
+    result.seconds += count * (cost.seconds + vertices * vertex_cost.seconds);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Predict the cost of a conversion without allocating VecGeom objects.
+ *
+ * This walks the Geant4 tree once, visiting each logical volume once, so it
+ * is fast even for geometries whose conversion would take minutes. The
+ * optional tables requested in \c options are included in the byte and time
+ * estimates.
+ */
+ConversionEstimate
+estimate(G4VPhysicalVolume const* world, Options const& options)
+{
+    if (!world)
+    {
+        throw std::invalid_argument("cannot estimate a null world volume");
+    }
+
+    Estimator est{options.touchable_volumes};
+    est.result.placed_volumes += 1;
+    est.result.vecgeom_bytes += placement_bytes;
+    auto const paths = est.visit(world->GetLogicalVolume());
+
+    auto& result = est.result;
+    result.touchables = paths.all;
+
+    // Tables indexed by volume ID, plus per-volume names and lookups
+    double entries = 0;
+    std::size_t bytes = 0;
+    std::size_t const num_helpers = result.logical_volumes
+                                    - est.volumes.size();
+    std::size_t const num_ids = est.volumes.size();
+    std::size_t const num_pv = result.placed_volumes - num_helpers;
+
+    // Dense ID lookups cover helper volumes as well
+    bytes += (result.logical_volumes + result.placed_volumes)
+             * (sizeof(void*) + sizeof(unsigned int));
+    for (auto const& lv_paths : est.volumes)
+    {
+        bytes += lv_paths.first->GetName().size() + 1;
+    }
+    bytes += est.volumes.size() * (sizeof(void*) + 3 * sizeof(void*));
+    bytes += num_ids
+             * (sizeof(G4LogicalVolume const*) + 6 * sizeof(unsigned int));
+    entries += num_ids;
+
+    if (options.daughter_order != DaughterOrder::geant4)
+    {
+        bytes += num_pv * sizeof(unsigned int);
+        entries += num_pv;
+    }
+    if (options.navigation_tables)
+    {
+        bytes += num_ids * (sizeof(unsigned int) + sizeof(void*))
+                 + num_pv * (12 * sizeof(double) + sizeof(unsigned int)
+                             + sizeof(void*));
+        entries += num_ids + num_pv;
+    }
+    if (options.placement_table)
+    {
+        bytes += num_ids * sizeof(unsigned int)
+                 + num_pv * (4 * sizeof(unsigned int) + 18 * sizeof(double));
+        entries += num_pv;
+    }
+    if (options.compact_transforms)
+    {
+        bytes += num_pv * (sizeof(unsigned int) + 3 * sizeof(double));
+        entries += num_pv;
+    }
+    if (options.linear_tree || !options.touchable_volumes.empty())
+    {
+        bytes += static_cast<std::size_t>(
+            paths.all * (4 * sizeof(unsigned int) + sizeof(unsigned short)));
+        entries += paths.all;
+    }
+    if (!options.touchable_volumes.empty())
+    {
+        bytes += estimate_touchable_bytes(paths.selected);
+        entries += paths.selected;
+    }
+    result.table_bytes = bytes;
+    result.seconds += entries * table_entry_seconds;
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the touchables of the selected volumes in a Geant4 tree.
+ *
+ * This is the number of rows \c build_touchable_transforms would create,
+ * counted as \c estimate does without building the linear tree.
+ */
+double count_touchables(G4VPhysicalVolume const* world,
+                        std::vector<G4LogicalVolume const*> const& selected)
+{
+    if (!world)
+    {
+        throw std::invalid_argument("cannot count touchables of a null world");
+    }
+    Estimator est{selected};
+    return est.visit(world->GetLogicalVolume()).selected;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
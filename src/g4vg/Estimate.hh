@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Estimate.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+
+#include "G4VG.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Predicted cost of converting a geometry.
+ *
+ * Object counts match what \c g4vg::convert creates: copies of a
+ * parameterised volume are separate placements but share the shape of their
+ * logical volume, as they do in the converted geometry. Byte and time
+ * predictions come from per-shape cost models and are only accurate to
+ * within a small factor: they are meant for choosing resources, not for
+ * accounting.
+ */
+struct ConversionEstimate
+{
+    //!@{
+    //! \name VecGeom objects to be created
+    std::size_t logical_volumes{0};  //!< Including boolean constituents
+    std::size_t placed_volumes{0};  //!< Including the world
+    std::size_t solids{0};
+    //!@}
+
+    //! Number of unique paths through the placement tree
+    double touchables{0};
+
+    //! Estimated VecGeom memory [bytes]
+    std::size_t vecgeom_bytes{0};
+    //! Estimated memory of the conversion tables [bytes]
+    std::size_t table_bytes{0};
+    //! Estimated conversion time [s]
+    double seconds{0};
+
+    //! Total estimated memory [bytes]
+    std::size_t bytes() const { return vecgeom_bytes + table_bytes; }
+};
+
+//---------------------------------------------------------------------------//
+// Predict the cost of a conversion without allocating VecGeom objects
+ConversionEstimate
+estimate(G4VPhysicalVolume const* world, Options const& options);
+
+// Count the touchables of the selected volumes in a Geant4 tree
+double count_touchables(G4VPhysicalVolume const* world,
+                        std::vector<G4LogicalVolume const*> const& selected);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
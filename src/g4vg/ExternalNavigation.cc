@@ -0,0 +1,421 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/ExternalNavigation.cc
+//---------------------------------------------------------------------------//
+#include "ExternalNavigation.hh"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <G4LogicalVolume.hh>
+#include <G4Point3D.hh>
+#include <G4VPVParameterisation.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+#include <G4Vector3D.hh>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "SolidConverter.hh"
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using VGVector = vecgeom::Vector3D<vecgeom::Precision>;
+
+//! Minimum cosine with the exit normal to block re-entering a daughter
+constexpr double min_exiting_normal_cosine = 1e-3;
+
+//! Distance below which a point is considered to be on a surface
+constexpr double surface_tolerance = 1e-9;
+
+//---------------------------------------------------------------------------//
+VGVector to_vg(G4ThreeVector const& v)
+{
+    return {v.x(), v.y(), v.z()};
+}
+
+G4ThreeVector to_g4(VGVector const& v)
+{
+    return {v.x(), v.y(), v.z()};
+}
+
+//---------------------------------------------------------------------------//
+//! Transform a point
+VGVector to_vg(G4Transform3D const& t, G4ThreeVector const& p)
+{
+    return to_vg(G4ThreeVector(t * G4Point3D(p)));
+}
+
+//! Transform a direction or normal (the transform is orthogonal)
+G4ThreeVector rotate(G4Transform3D const& t, G4ThreeVector const& v)
+{
+    return G4ThreeVector(t * G4Vector3D(v));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the result of a conversion.
+ *
+ * This matches each VecGeom daughter to the Geant4 physical volume (and
+ * replica number) it was created from. The converter places daughters in the
+ * same order as Geant4, with replicated and parameterised volumes expanded
+ * into one placement per copy; if the daughters were reordered, their
+ * original positions are stored in \c Converted::daughter_slots .
+ */
+ExternalNavigation::ExternalNavigation(Converted const& converted)
+{
+    auto tables = std::make_shared<Tables>();
+    tables->mothers.reserve(converted.volume_ids.size());
+    for (auto&& [g4lv, id] : converted.volume_ids)
+    {
+        Mother mother;
+        mother.vg = converted.ids.volume(id);
+        mother.shape.vg = mother.vg->GetUnplacedVolume();
+        mother.shape.from_vg = unwrap_solid(*g4lv->GetSolid()).transform;
+        mother.shape.to_vg = mother.shape.from_vg.inverse();
+
+        // Expand Geant4 daughters in their original order
+        std::vector<Daughter> g4_daughters;
+        for (std::size_t i = 0; i != g4lv->GetNoDaughters(); ++i)
+        {
+            G4VPhysicalVolume* g4pv = g4lv->GetDaughter(i);
+            Daughter d;
+            d.g4 = g4pv;
+            d.type = g4pv->VolumeType();
+            int const num_copies
+                = (d.type == kNormal ? 1 : g4pv->GetMultiplicity());
+            for (int copy = 0; copy != num_copies; ++copy)
+            {
+                d.replica = (d.type == kNormal ? -1 : copy);
+                g4_daughters.push_back(d);
+            }
+        }
+
+        auto const& vg_daughters = mother.vg->GetDaughters();
+        if (g4_daughters.size() != vg_daughters.size())
+        {
+            throw std::runtime_error(
+                "daughters of Geant4 volume '" + std::string(g4lv->GetName())
+                + "' do not match the converted VecGeom volume");
+        }
+
+        // Match in the (possibly reordered) VecGeom order
+        auto const& slots = converted.daughter_slots;
+        mother.daughters.reserve(vg_daughters.size());
+        for (std::size_t i = 0; i != vg_daughters.size(); ++i)
+        {
+            auto const* vgpv = vg_daughters[i];
+            Daughter d = g4_daughters[slots.empty()
+                                          ? i
+                                          : slots[converted.ids.id(*vgpv)]];
+            d.vg = vgpv;
+            mother.daughters.push_back(d);
+        }
+
+        tables->solids.insert({g4lv->GetSolid(), mother.shape});
+        tables->mothers.insert({g4lv, std::move(mother)});
+    }
+    tables_ = std::move(tables);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a navigator for another thread sharing the same tables.
+ */
+G4VExternalNavigation* ExternalNavigation::Clone()
+{
+    auto* result = new ExternalNavigation(*this);
+    result->fVerbose = fVerbose;
+    result->fCheck = fCheck;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Search the daughters of the current volume for the point.
+ *
+ * Daughters are tested from last to first, as in \c G4NormalNavigation , so
+ * that overlapping daughters resolve the same way. On success, the located
+ * daughter is pushed onto the history and the local point is updated to its
+ * frame.
+ */
+G4bool ExternalNavigation::LevelLocate(G4NavigationHistory& history,
+                                       G4VPhysicalVolume const* blockedVol,
+                                       G4int const blockedNum,
+                                       G4ThreeVector const& globalPoint,
+                                       G4ThreeVector const* globalDirection,
+                                       G4bool const pLocatedOnEdge,
+                                       G4ThreeVector& localPoint)
+{
+    Mother const& mother = this->find_mother(history);
+    if (mother.daughters.empty())
+    {
+        return false;
+    }
+
+    G4AffineTransform const& mother_transform = history.GetTopTransform();
+    Shape const& frame = mother.shape;
+    VGVector const pos
+        = to_vg(frame.to_vg, mother_transform.TransformPoint(globalPoint));
+
+    for (auto iter = mother.daughters.rbegin();
+         iter != mother.daughters.rend();
+         ++iter)
+    {
+        Daughter const& d = *iter;
+        if (d.g4 == blockedVol
+            && (d.type == kNormal || d.replica == blockedNum))
+        {
+            continue;
+        }
+
+        VGVector daughter_pos;
+        if (!d.vg->Contains(pos, daughter_pos))
+        {
+            continue;
+        }
+
+        if (pLocatedOnEdge && globalDirection)
+        {
+            // Reject the daughter if we're on its surface and leaving it
+            VGVector const daughter_dir
+                = d.vg->GetTransformation()->TransformDirection(
+                    to_vg(rotate(frame.to_vg,
+                                 mother_transform.TransformAxis(
+                                     *globalDirection))));
+            if (d.vg->GetUnplacedVolume()->DistanceToOut(
+                    daughter_pos, daughter_dir, vecgeom::kInfLength)
+                <= surface_tolerance)
+            {
+                continue;
+            }
+        }
+
+        this->update_transform(d);
+        history.NewLevel(
+            d.g4, d.type, d.type == kNormal ? d.g4->GetCopyNo() : d.replica);
+        localPoint = history.GetTopTransform().TransformPoint(globalPoint);
+        return true;
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute the distance to the next boundary in the current volume.
+ *
+ * This follows the conventions of \c G4NormalNavigation::ComputeStep
+ * (including testing daughters from last to first) but uses the VecGeom shape
+ * algorithms for the mother and its daughters.
+ */
+G4double
+ExternalNavigation::ComputeStep(G4ThreeVector const& localPoint,
+                                G4ThreeVector const& localDirection,
+                                G4double const currentProposedStepLength,
+                                G4double& newSafety,
+                                G4NavigationHistory& history,
+                                G4bool& validExitNormal,
+                                G4ThreeVector& exitNormal,
+                                G4bool& exiting,
+                                G4bool& entering,
+                                G4VPhysicalVolume*(*pBlockedPhysical),
+                                G4int& blockedReplicaNo)
+{
+    Mother const& mother = this->find_mother(history);
+    Shape const& frame = mother.shape;
+    VGVector const pos = to_vg(frame.to_vg, localPoint);
+    VGVector const dir = to_vg(rotate(frame.to_vg, localDirection));
+
+    // Don't immediately re-enter the daughter we just exited
+    G4VPhysicalVolume const* blocked_exited = nullptr;
+    int blocked_replica = -1;
+    if (exiting && validExitNormal
+        && localDirection.dot(exitNormal) >= min_exiting_normal_cosine)
+    {
+        blocked_exited = *pBlockedPhysical;
+        blocked_replica = blockedReplicaNo;
+    }
+    exiting = false;
+    entering = false;
+
+    auto const* mother_shape = frame.vg;
+    double const mother_safety = std::max(mother_shape->SafetyToOut(pos), 0.0);
+    // A point that just exited a daughter is on its surface
+    double safety = blocked_exited ? 0.0 : mother_safety;
+    double step = currentProposedStepLength;
+
+    for (auto iter = mother.daughters.rbegin();
+         iter != mother.daughters.rend();
+         ++iter)
+    {
+        Daughter const& d = *iter;
+        if (d.g4 == blocked_exited
+            && (d.type == kNormal || d.replica == blocked_replica))
+        {
+            continue;
+        }
+        double const daughter_safety = std::max(d.vg->SafetyToIn(pos), 0.0);
+        safety = std::min(safety, daughter_safety);
+        if (daughter_safety <= step)
+        {
+            double const daughter_step = d.vg->DistanceToIn(pos, dir, step);
+            if (daughter_step <= step)
+            {
+                step = daughter_step;
+                entering = true;
+                exiting = false;
+                *pBlockedPhysical = d.g4;
+                blockedReplicaNo = d.replica;
+            }
+        }
+    }
+
+    if (currentProposedStepLength < safety)
+    {
+        // Step is guaranteed to be limited by physics
+        entering = false;
+        exiting = false;
+        *pBlockedPhysical = nullptr;
+        step = kInfinity;
+    }
+    else if (mother_safety <= step)
+    {
+        double const mother_step
+            = std::max(mother_shape->DistanceToOut(pos, dir, step), 0.0);
+        if (mother_step <= step)
+        {
+            step = mother_step;
+            exiting = true;
+            entering = false;
+
+            VGVector normal;
+            validExitNormal = mother_shape->Normal(pos + step * dir, normal);
+            if (validExitNormal)
+            {
+                exitNormal = rotate(frame.from_vg, to_g4(normal));
+            }
+        }
+        else
+        {
+            validExitNormal = false;
+        }
+    }
+
+    newSafety = safety;
+    return step;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute the isotropic safety distance in the current volume.
+ *
+ * The point is in the local frame of the volume at the top of the history.
+ */
+G4double ExternalNavigation::ComputeSafety(G4ThreeVector const& localPoint,
+                                           G4NavigationHistory const& history,
+                                           G4double const)
+{
+    Mother const& mother = this->find_mother(history);
+    VGVector const pos = to_vg(mother.shape.to_vg, localPoint);
+
+    double safety = mother.shape.vg->SafetyToOut(pos);
+    for (Daughter const& d : mother.daughters)
+    {
+        safety = std::min(safety, d.vg->SafetyToIn(pos));
+    }
+    return std::max(safety, 0.0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Determine whether a point is inside a solid using its VecGeom shape.
+ *
+ * The position is transformed from the frame of the Geant4 solid, which may
+ * be displaced or reflected, to that of the converted shape. Solids that were
+ * not converted (e.g. boolean constituents) fall back to Geant4.
+ */
+EInside ExternalNavigation::Inside(G4VSolid const* solid,
+                                   G4ThreeVector const& position,
+                                   G4ThreeVector const& direction)
+{
+    auto iter = tables_->solids.find(solid);
+    if (iter == tables_->solids.end())
+    {
+        return G4VExternalNavigation::Inside(solid, position, direction);
+    }
+
+    Shape const& shape = iter->second;
+    auto result = shape.vg->Inside(to_vg(shape.to_vg, position));
+    if (result == vecgeom::EInside::kInside)
+    {
+        return ::kInside;
+    }
+    if (result == vecgeom::EInside::kOutside)
+    {
+        return ::kOutside;
+    }
+    return ::kSurface;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the converted volume at the top of the navigation history.
+ */
+auto ExternalNavigation::find_mother(G4NavigationHistory const& history) const
+    -> Mother const&
+{
+    G4LogicalVolume const* g4lv = history.GetTopVolume()->GetLogicalVolume();
+    auto iter = tables_->mothers.find(g4lv);
+    if (iter == tables_->mothers.end())
+    {
+        throw std::runtime_error("Geant4 volume '"
+                                 + std::string(g4lv->GetName())
+                                 + "' was not converted to VecGeom");
+    }
+    return iter->second;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Update the Geant4 transform of a replicated or parameterised daughter.
+ *
+ * Geant4 stores a single physical volume for all copies, so its transform
+ * (and for parameterisations, its solid dimensions and material) must be set
+ * to the copy before it is pushed onto the history.
+ */
+void ExternalNavigation::update_transform(Daughter const& d) const
+{
+    switch (d.type)
+    {
+        case kReplica:
+            replica_nav_.ComputeTransformation(d.replica, d.g4);
+            break;
+        case kParameterised: {
+            G4VPVParameterisation* param = d.g4->GetParameterisation();
+            param->ComputeTransformation(d.replica, d.g4);
+            G4LogicalVolume* lv = d.g4->GetLogicalVolume();
+            G4VSolid* solid = param->ComputeSolid(d.replica, d.g4);
+            solid->ComputeDimensions(param, d.replica, d.g4);
+            lv->SetSolid(solid);
+            if (G4Material* mat = param->ComputeMaterial(d.replica, d.g4))
+            {
+                lv->UpdateMaterial(mat);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,149 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/ExternalNavigation.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <G4ReplicaNavigation.hh>
+#include <G4Transform3D.hh>
+#include <G4VExternalNavigation.hh>
+
+#include "G4VG.hh"
+
+namespace vecgeom
+{
+inline namespace cxx
+{
+class LogicalVolume;
+class VUnplacedVolume;
+}  // namespace cxx
+}  // namespace vecgeom
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Geant4 navigation delegate backed by the converted VecGeom geometry.
+ *
+ * This answers the per-level navigation queries of a \c G4Navigator (point
+ * location, step, and safety) using the VecGeom shapes and placements created
+ * by \c g4vg::convert . The navigation history is still built from the
+ * original Geant4 physical volumes, so touchables, sensitive detectors, and
+ * regions work unchanged.
+ *
+ * The volume mapping is built once and shared (read-only) between all clones,
+ * so each worker thread's navigator can own a cheap copy:
+ * \code
+   auto converted = g4vg::convert(world);
+   g4vg::ExternalNavigation master_nav{converted};
+   // In each worker:
+   navigator->SetExternalNavigation(master_nav.Clone());
+ * \endcode
+ *
+ * Displaced and reflected solids are converted to their unwrapped shape, so
+ * points and directions are transformed from the Geant4 solid's frame into
+ * the shape's frame (and normals back) for each query.
+ *
+ * The converted geometry must outlive all navigators using it.
+ * Daughters of replicated and parameterised volumes are supported as long as
+ * the parameterisation does not change the solid, its dimensions, or the
+ * daughters of each copy: all copies are navigated with the one VecGeom
+ * shape of their logical volume, and the converter rejects parameterisations
+ * that change the solid or its dimensions.
+ */
+class ExternalNavigation final : public G4VExternalNavigation
+{
+  public:
+    // Construct from the result of a conversion
+    explicit ExternalNavigation(Converted const& converted);
+
+    // Create a navigator for another thread sharing the same tables
+    G4VExternalNavigation* Clone() final;
+
+    // Search the daughters of the current volume for the point
+    G4bool LevelLocate(G4NavigationHistory& history,
+                       G4VPhysicalVolume const* blockedVol,
+                       G4int const blockedNum,
+                       G4ThreeVector const& globalPoint,
+                       G4ThreeVector const* globalDirection,
+                       G4bool const pLocatedOnEdge,
+                       G4ThreeVector& localPoint) final;
+
+    // Compute the distance to the next boundary in the current volume
+    G4double ComputeStep(G4ThreeVector const& localPoint,
+                         G4ThreeVector const& localDirection,
+                         G4double const currentProposedStepLength,
+                         G4double& newSafety,
+                         G4NavigationHistory& history,
+                         G4bool& validExitNormal,
+                         G4ThreeVector& exitNormal,
+                         G4bool& exiting,
+                         G4bool& entering,
+                         G4VPhysicalVolume*(*pBlockedPhysical),
+                         G4int& blockedReplicaNo) final;
+
+    // Compute the isotropic safety distance in the current volume
+    G4double ComputeSafety(G4ThreeVector const& localPoint,
+                           G4NavigationHistory const& history,
+                           G4double const pMaxLength) final;
+
+    // Determine whether a point is inside a solid using its VecGeom shape
+    EInside Inside(G4VSolid const* solid,
+                   G4ThreeVector const& position,
+                   G4ThreeVector const& direction) final;
+
+  private:
+    //// TYPES ////
+
+    using VGLogicalVolume = vecgeom::LogicalVolume;
+    using VGPlacedVolume = vecgeom::VPlacedVolume;
+    using VGUnplacedVolume = vecgeom::VUnplacedVolume;
+
+    struct Daughter
+    {
+        VGPlacedVolume const* vg{nullptr};
+        G4VPhysicalVolume* g4{nullptr};
+        EVolume type{kNormal};
+        int replica{-1};  //!< Replica/parameterisation copy, -1 if normal
+    };
+
+    //! Unwrapped shape and the transform from the Geant4 solid's frame
+    struct Shape
+    {
+        VGUnplacedVolume const* vg{nullptr};
+        G4Transform3D to_vg;
+        G4Transform3D from_vg;
+    };
+
+    struct Mother
+    {
+        VGLogicalVolume const* vg{nullptr};
+        Shape shape;
+        std::vector<Daughter> daughters;
+    };
+
+    struct Tables
+    {
+        std::unordered_map<G4LogicalVolume const*, Mother> mothers;
+        std::unordered_map<G4VSolid const*, Shape> solids;
+    };
+
+    //// DATA ////
+
+    std::shared_ptr<Tables const> tables_;
+    G4ReplicaNavigation replica_nav_;
+
+    //// HELPER FUNCTIONS ////
+
+    Mother const& find_mother(G4NavigationHistory const& history) const;
+    void update_transform(Daughter const& d) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
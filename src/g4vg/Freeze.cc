@@ -0,0 +1,232 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Freeze.cc
+//---------------------------------------------------------------------------//
+#include "Freeze.hh"
+
+#include <string>
+#include <vector>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+template<class T>
+std::size_t vec_bytes(std::vector<T> const& v)
+{
+    return v.capacity() * sizeof(T);
+}
+
+std::size_t vec_bytes(std::vector<bool> const& v)
+{
+    return v.capacity() / 8;
+}
+
+std::size_t str_bytes(std::string const& s)
+{
+    // Short strings are stored inline
+    return s.capacity() > std::string{}.capacity() ? s.capacity() + 1 : 0;
+}
+
+template<class K, class V>
+std::size_t map_bytes(std::unordered_map<K, V> const& m)
+{
+    // One node (value, next pointer, cached hash) per entry plus buckets
+    using Node = std::pair<K const, V>;
+    return m.size() * (sizeof(Node) + 2 * sizeof(void*))
+           + m.bucket_count() * sizeof(void*);
+}
+
+template<class T>
+void shrink(std::vector<T>* v)
+{
+    v->shrink_to_fit();
+}
+
+//! Apply a function to every array in a (const or mutable) placement table
+template<class T, class F>
+void visit_vectors(T& table, F&& visit)
+{
+    visit(table.offsets);
+    visit(table.mother);
+    visit(table.volume);
+    visit(table.placed);
+    visit(table.copy_number);
+    for (int i = 0; i < 3; ++i)
+    {
+        visit(table.translation[i]);
+        visit(table.bbox_lower[i]);
+        visit(table.bbox_upper[i]);
+    }
+    for (auto& v : table.rotation)
+    {
+        visit(v);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Estimate the heap memory used by the g4vg-owned conversion tables.
+ *
+ * This includes the bookkeeping of \c Converted::store but not the VecGeom
+ * objects it owns.
+ */
+std::size_t memory_bytes(Converted const& c)
+{
+    std::size_t result = c.ids.memory_bytes();
+    result += map_bytes(c.volume_ids);
+    result += vec_bytes(c.logical_volumes);
+    result += vec_bytes(c.daughter_slots);
+    result += c.names.memory_bytes();
+    result += vec_bytes(c.volume_names);
+
+    auto const& mat = c.materials;
+    result += vec_bytes(mat.material) + vec_bytes(mat.density)
+              + vec_bytes(mat.electron_density)
+              + vec_bytes(mat.radiation_length)
+              + vec_bytes(mat.nuclear_interaction_length)
+              + vec_bytes(mat.mean_excitation_energy)
+              + vec_bytes(mat.volume_material);
+
+    auto const& attr = c.attributes;
+    result += vec_bytes(attr.regions) + vec_bytes(attr.region_cuts)
+              + vec_bytes(attr.production_cuts)
+              + vec_bytes(attr.volume_region) + vec_bytes(attr.volume_cuts)
+              + vec_bytes(attr.sensitive) + vec_bytes(attr.field)
+              + vec_bytes(attr.aux_offsets) + vec_bytes(attr.aux);
+    for (auto const& aux : attr.aux)
+    {
+        result += str_bytes(aux.type) + str_bytes(aux.value)
+                  + str_bytes(aux.unit);
+    }
+
+    auto nav_bytes = [](NavigationTables const& nav) {
+        return vec_bytes(nav.daughter_offsets) + vec_bytes(nav.shape)
+               + vec_bytes(nav.daughter_volume)
+               + vec_bytes(nav.daughter_transform) + vec_bytes(nav.daughter);
+    };
+    result += nav_bytes(c.navigation);
+    for (auto const& nav : c.numa_navigation)
+    {
+        result += nav_bytes(nav);
+    }
+
+    result += c.transforms.memory_bytes();
+    visit_vectors(c.placements,
+                  [&result](auto const& v) { result += vec_bytes(v); });
+    for (auto const& table : c.numa_placements)
+    {
+        visit_vectors(table,
+                      [&result](auto const& v) { result += vec_bytes(v); });
+    }
+
+    auto const& tree = c.tree;
+    result += vec_bytes(tree.placed) + vec_bytes(tree.volume)
+              + vec_bytes(tree.parent) + vec_bytes(tree.skip)
+              + vec_bytes(tree.depth);
+
+    auto const& touch = c.touchables;
+    result += vec_bytes(touch.node) + vec_bytes(touch.transform);
+
+    result += vec_bytes(c.wrapped.shapes);
+    result += c.store.memory_bytes();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release construction-only data and compact the converted tables.
+ */
+FreezeResult freeze(Converted* converted)
+{
+    return freeze(converted, {});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Freeze with custom options.
+ *
+ * The converter's own caches (solid and volume maps, intermediate vectors)
+ * are already released when \c g4vg::convert returns. This releases the
+ * remaining construction-only data held by the result (the name lookup index
+ * and, optionally, the Geant4 volume map) and trims all tables to their final
+ * size. Per-ID lookups are unaffected. NUMA copies of the tables are
+ * already exact and are left alone, since reallocating them here would move
+ * them off their nodes.
+ */
+FreezeResult freeze(Converted* c, FreezeOptions const& options)
+{
+    FreezeResult result;
+    result.bytes_before = memory_bytes(*c);
+
+    if (options.keep_volume_map)
+    {
+        c->volume_ids.rehash(0);
+    }
+    else
+    {
+        Converted::MapLvVolId{}.swap(c->volume_ids);
+    }
+    c->ids.shrink_to_fit();
+    shrink(&c->logical_volumes);
+    shrink(&c->daughter_slots);
+    c->names.compact();
+    shrink(&c->volume_names);
+
+    auto& mat = c->materials;
+    shrink(&mat.material);
+    shrink(&mat.density);
+    shrink(&mat.electron_density);
+    shrink(&mat.radiation_length);
+    shrink(&mat.nuclear_interaction_length);
+    shrink(&mat.mean_excitation_energy);
+    shrink(&mat.volume_material);
+
+    auto& attr = c->attributes;
+    shrink(&attr.regions);
+    shrink(&attr.region_cuts);
+    shrink(&attr.production_cuts);
+    shrink(&attr.volume_region);
+    shrink(&attr.volume_cuts);
+    shrink(&attr.sensitive);
+    shrink(&attr.field);
+    shrink(&attr.aux_offsets);
+    shrink(&attr.aux);
+
+    auto& nav = c->navigation;
+    shrink(&nav.daughter_offsets);
+    shrink(&nav.shape);
+    shrink(&nav.daughter_volume);
+    shrink(&nav.daughter_transform);
+    shrink(&nav.daughter);
+
+    c->transforms.shrink_to_fit();
+    visit_vectors(c->placements, [](auto& v) { shrink(&v); });
+
+    auto& tree = c->tree;
+    shrink(&tree.placed);
+    shrink(&tree.volume);
+    shrink(&tree.parent);
+    shrink(&tree.skip);
+    shrink(&tree.depth);
+
+    auto& touch = c->touchables;
+    shrink(&touch.node);
+    shrink(&touch.transform);
+
+    shrink(&c->wrapped.shapes);
+    c->store.shrink_to_fit();
+
+    result.bytes_after = memory_bytes(*c);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Freeze.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+
+#include "G4VG.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Options for releasing conversion-only data.
+ */
+struct FreezeOptions
+{
+    //! Keep the Geant4-to-VecGeom volume map (needed by ExternalNavigation)
+    bool keep_volume_map{true};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Memory used by the converted tables before and after freezing.
+ */
+struct FreezeResult
+{
+    std::size_t bytes_before{0};
+    std::size_t bytes_after{0};
+
+    //! Number of bytes released
+    std::size_t reclaimed() const { return bytes_before - bytes_after; }
+};
+
+//---------------------------------------------------------------------------//
+// Estimate the heap memory used by the g4vg-owned conversion tables
+std::size_t memory_bytes(Converted const& converted);
+
+// Release construction-only data and compact the converted tables
+FreezeResult freeze(Converted* converted);
+
+// Freeze with custom options
+FreezeResult freeze(Converted* converted, FreezeOptions const& options);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
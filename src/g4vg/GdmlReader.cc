@@ -0,0 +1,193 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GdmlReader.cc
+//---------------------------------------------------------------------------//
+#include "GdmlReader.hh"
+
+#include <stdexcept>
+#include <unordered_set>
+#include <VecGeom/management/GeoManager.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+#include <VecGeom/volumes/UnplacedVolume.h>
+
+#include "NumaReplicated.hh"
+
+#ifdef G4VG_USE_VGDML
+#    include <VecGeom/gdml/Frontend.h>
+#endif
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership of the VecGeom objects registered from the given IDs on.
+ *
+ * VecGeom IDs come from global counters, so every volume the frontend
+ * creates (including boolean constituents) has a larger ID than those that
+ * existed before it was loaded.
+ */
+VolumeStore
+track_created(unsigned int volume_begin, unsigned int placement_begin)
+{
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    VolumeStore result;
+
+    std::unordered_set<vecgeom::VUnplacedVolume const*> shapes;
+    auto const& volumes = vg_manager.GetLogicalVolumesMap();
+    for (auto iter = volumes.lower_bound(volume_begin); iter != volumes.end();
+         ++iter)
+    {
+        vecgeom::LogicalVolume* lv = iter->second;
+        result.insert(lv);
+        if (shapes.insert(lv->GetUnplacedVolume()).second)
+        {
+            result.insert(lv->GetUnplacedVolume());
+        }
+    }
+
+    auto const placement_end = vecgeom::VPlacedVolume::GetIdCount();
+    for (auto id = placement_begin; id < placement_end; ++id)
+    {
+        if (auto* pv = vg_manager.FindPlacedVolume(id))
+        {
+            result.insert(pv);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+bool has_gdml_reader()
+{
+#ifdef G4VG_USE_VGDML
+    return true;
+#else
+    return false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a GDML file directly into VecGeom without building Geant4 objects.
+ *
+ * This is for tools that need only the VecGeom geometry: it avoids
+ * constructing (and holding in memory) the full Geant4 geometry just to
+ * convert it. The file is parsed by the VecGeom GDML frontend, which replaces
+ * any geometry already loaded in the \c GeoManager .
+ *
+ * \warning Shapes are built by the frontend rather than by \c SolidConverter ,
+ * which needs Geant4 solids, so they may differ from a conversion for solids
+ * that the two map differently (e.g., wrapped or client-registered solids).
+ * The frontend also reads the whole XML document into memory before building
+ * the geometry: this saves the Geant4 geometry but not the parse.
+ *
+ * Since there are no Geant4 volumes, \c volume_ids and \c logical_volumes are
+ * empty and the material and attribute tables are not built. Volume names
+ * come from the GDML file. Volume IDs are assigned from the loaded world in
+ * the same depth-first order as \c g4vg::convert , and the volumes created
+ * by the frontend that are not reachable from it (such as boolean
+ * constituents) are numbered afterward. The frontend's objects are moved
+ * into \c store , so they are deleted with the result as for a conversion.
+ *
+ * Options that require Geant4 objects (touchable transforms, unreachable
+ * reporting, and GDML auxiliary tags) are rejected. Daughter ordering is
+ * also rejected: it is applied as the converter places daughters, and the
+ * frontend has already placed them.
+ */
+Converted read_gdml(std::string const& filename, Options const& options)
+{
+    if (options.daughter_order != DaughterOrder::geant4
+        || !options.touchable_volumes.empty() || options.report_unreachable
+        || options.gdml_aux)
+    {
+        throw std::invalid_argument(
+            "options requiring Geant4 volumes or daughter reordering cannot "
+            "be used when reading GDML directly");
+    }
+
+    // Objects created by the frontend have IDs from these on
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    auto const& lv_map = vg_manager.GetLogicalVolumesMap();
+    unsigned int const lv_begin = lv_map.empty() ? 0
+                                                 : lv_map.rbegin()->first + 1;
+    unsigned int const pv_begin = vecgeom::VPlacedVolume::GetIdCount();
+
+#ifdef G4VG_USE_VGDML
+    vgdml::Frontend::Load(filename,
+                          /* validate_xml_schema = */ false,
+                          /* mm_unit = */ 1 / Options::scale,
+                          /* verbose = */ options.verbose);
+#else
+    throw std::runtime_error("cannot read '" + filename
+                             + "': G4VG was not built with VecGeom GDML "
+                               "support (G4VG_USE_VGDML)");
+#endif
+
+    Converted converted;
+    converted.store = track_created(lv_begin, pv_begin);
+    converted.world = vg_manager.GetWorld();
+    if (!converted.world)
+    {
+        throw std::runtime_error("failed to read a world volume from '"
+                                 + filename + "'");
+    }
+
+    converted.ids = VolumeIds{converted.world, converted.store};
+    auto const& ids = converted.ids;
+
+    // Intern GDML names in order of volume ID
+    converted.volume_names.reserve(ids.num_volumes());
+    for (unsigned int id = 0; id != ids.num_volumes(); ++id)
+    {
+        // The frontend created these volumes, so they may be modified
+        auto* vglv = const_cast<vecgeom::LogicalVolume*>(ids.volume(id));
+        converted.volume_names.push_back(
+            converted.names.insert(vglv->GetLabel()));
+        if (!options.vecgeom_names)
+        {
+            vglv->SetLabel("");
+        }
+    }
+
+    if (options.navigation_tables)
+    {
+        converted.navigation = build_navigation_tables(ids);
+    }
+    if (options.placement_table)
+    {
+        converted.placements = build_placement_table(ids);
+    }
+    if (options.numa_tables && numa_node_count() > 1)
+    {
+        if (options.navigation_tables)
+        {
+            converted.numa_navigation = numa_replicate(converted.navigation);
+        }
+        if (options.placement_table)
+        {
+            converted.numa_placements = numa_replicate(converted.placements);
+        }
+    }
+    if (options.linear_tree)
+    {
+        converted.tree = build_linear_tree(ids);
+    }
+    if (options.compact_transforms)
+    {
+        converted.transforms
+            = CompactTransforms{ids, options.transform_options};
+    }
+    return converted;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
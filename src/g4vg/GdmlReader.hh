@@ -0,0 +1,30 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GdmlReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+
+#include "G4VG.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Whether GDML can be read directly into VecGeom.
+ *
+ * This requires building with \c G4VG_USE_VGDML , which is enabled by default
+ * when the VecGeom installation has GDML support.
+ */
+bool has_gdml_reader();
+
+//---------------------------------------------------------------------------//
+// Read a GDML file directly into VecGeom without building Geant4 objects
+Converted read_gdml(std::string const& filename, Options const& options);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
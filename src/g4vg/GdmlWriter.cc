@@ -0,0 +1,1001 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GdmlWriter.cc
+//---------------------------------------------------------------------------//
+#include "GdmlWriter.hh"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <G4Element.hh>
+#include <G4Material.hh>
+#include <G4SystemOfUnits.hh>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+#include <VecGeom/volumes/UnplacedBooleanVolume.h>
+#include <VecGeom/volumes/UnplacedBox.h>
+#include <VecGeom/volumes/UnplacedCone.h>
+#include <VecGeom/volumes/UnplacedCutTube.h>
+#include <VecGeom/volumes/UnplacedEllipsoid.h>
+#include <VecGeom/volumes/UnplacedEllipticalCone.h>
+#include <VecGeom/volumes/UnplacedEllipticalTube.h>
+#include <VecGeom/volumes/UnplacedExtruded.h>
+#include <VecGeom/volumes/UnplacedGenTrap.h>
+#include <VecGeom/volumes/UnplacedGenericPolycone.h>
+#include <VecGeom/volumes/UnplacedHype.h>
+#include <VecGeom/volumes/UnplacedMultiUnion.h>
+#include <VecGeom/volumes/UnplacedOrb.h>
+#include <VecGeom/volumes/UnplacedParaboloid.h>
+#include <VecGeom/volumes/UnplacedParallelepiped.h>
+#include <VecGeom/volumes/UnplacedPolycone.h>
+#include <VecGeom/volumes/UnplacedPolyhedron.h>
+#include <VecGeom/volumes/UnplacedScaledShape.h>
+#include <VecGeom/volumes/UnplacedSphere.h>
+#include <VecGeom/volumes/UnplacedTessellated.h>
+#include <VecGeom/volumes/UnplacedTet.h>
+#include <VecGeom/volumes/UnplacedTorus2.h>
+#include <VecGeom/volumes/UnplacedTrapezoid.h>
+#include <VecGeom/volumes/UnplacedTrd.h>
+#include <VecGeom/volumes/UnplacedTube.h>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using Real3 = std::array<double, 3>;
+using VGLogicalVolume = vecgeom::LogicalVolume;
+using VGPlacedVolume = vecgeom::VPlacedVolume;
+using VGUnplacedVolume = vecgeom::VUnplacedVolume;
+using VGVector = vecgeom::Vector3D<double>;
+
+//---------------------------------------------------------------------------//
+//! Convert a VecGeom vector to a map key
+Real3 to_real3(VGVector const& v)
+{
+    return {v[0], v[1], v[2]};
+}
+
+//---------------------------------------------------------------------------//
+//! Get the vertices of a tetrahedron
+std::array<VGVector, 4> tet_vertices(vecgeom::UnplacedTet const& s)
+{
+    std::array<VGVector, 4> result;
+    s.GetVertices(result[0], result[1], result[2], result[3]);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Write a string with XML special characters escaped
+struct Escaped
+{
+    std::string const& s;
+};
+
+std::ostream& operator<<(std::ostream& os, Escaped const& e)
+{
+    for (char c : e.s)
+    {
+        switch (c)
+        {
+            case '&':
+                os << "&amp;";
+                break;
+            case '<':
+                os << "&lt;";
+                break;
+            case '>':
+                os << "&gt;";
+                break;
+            case '"':
+                os << "&quot;";
+                break;
+            default:
+                os << c;
+        }
+    }
+    return os;
+}
+
+//---------------------------------------------------------------------------//
+//! Placement decomposed into GDML position, rotation angles, and reflection
+struct Decomposed
+{
+    Real3 position{0, 0, 0};
+    Real3 angles{0, 0, 0};
+    bool reflected{false};
+};
+
+/*!
+ * Decompose a VecGeom transform into GDML components.
+ *
+ * A VecGeom transform maps local to mother coordinates as \f$ M x + t \f$,
+ * with \f$ M_{ji} \f$ stored in \c Rotation(3j+i) . Geant4 reads a GDML
+ * placement as \f$ R^{-1} S \f$ where \f$ R = R_z R_y R_x \f$ is built from
+ * the three angles and \f$ S \f$ is an optional reflection, so the angles
+ * are extracted from \f$ R = S M^T \f$ as in \c G4GDMLWriteDefine::GetAngles .
+ */
+Decomposed decompose(vecgeom::Transformation3D const& xf)
+{
+    Decomposed result;
+    for (int i = 0; i < 3; ++i)
+    {
+        result.position[i] = xf.Translation(i);
+    }
+    if (!xf.HasRotation())
+    {
+        return result;
+    }
+
+    double m[3][3];
+    for (int j = 0; j < 3; ++j)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            m[j][i] = xf.Rotation(3 * j + i);
+        }
+    }
+    double const det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+                       - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+                       + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    result.reflected = det < 0;
+
+    double r[3][3];
+    for (int a = 0; a < 3; ++a)
+    {
+        double const sign = (result.reflected && a == 2) ? -1 : 1;
+        for (int b = 0; b < 3; ++b)
+        {
+            r[a][b] = sign * m[b][a];
+        }
+    }
+
+    double const cosb = std::hypot(r[0][0], r[1][0]);
+    if (cosb > 16 * std::numeric_limits<double>::epsilon())
+    {
+        result.angles = {std::atan2(r[2][1], r[2][2]),
+                         std::atan2(-r[2][0], cosb),
+                         std::atan2(r[1][0], r[0][0])};
+    }
+    else
+    {
+        result.angles = {std::atan2(-r[1][2], r[1][1]),
+                         std::atan2(-r[2][0], cosb),
+                         0.0};
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stream the sections of a GDML file.
+ *
+ * Volumes are visited in order of increasing volume ID, which places every
+ * daughter before its mother as GDML requires. Only the IDs of shared
+ * objects (solids, positions, rotations) are kept in memory; nothing else is
+ * buffered.
+ */
+class Writer
+{
+  public:
+    Writer(Converted const& converted,
+           std::ostream& os,
+           GdmlWriteOptions const& options);
+
+    void define();
+    void materials();
+    void solids();
+    void structure();
+    void setup();
+
+  private:
+    Converted const& converted_;
+    std::ostream& os_;
+    GdmlWriteOptions const& options_;
+
+    // Logical volumes reachable from the world, in ID order
+    std::vector<VGLogicalVolume const*> volumes_;
+
+    // Shared objects that have been written
+    std::map<Real3, unsigned int> positions_;
+    std::map<Real3, unsigned int> rotations_;
+    bool wrote_reflection_{false};
+    std::unordered_map<VGUnplacedVolume const*, unsigned int> solids_;
+    std::unordered_set<unsigned int> reflected_solids_;
+
+    void define(vecgeom::Transformation3D const& xf);
+    void define(VGUnplacedVolume const* uv);
+    void define_position(Real3 const& pos);
+    void write_refs(vecgeom::Transformation3D const& xf,
+                    char const* indent,
+                    char const* prefix = "");
+    unsigned int write_solid(VGUnplacedVolume const* uv,
+                             VGLogicalVolume const& lv);
+    std::string
+    write_constituent(VGPlacedVolume const* pv, VGLogicalVolume const& lv);
+    template<vecgeom::BooleanOperation Op>
+    bool write_boolean(VGUnplacedVolume const* uv,
+                       char const* tag,
+                       VGLogicalVolume const& lv);
+    bool write_scaled(VGUnplacedVolume const* uv, VGLogicalVolume const& lv);
+    bool
+    write_multi_union(VGUnplacedVolume const* uv, VGLogicalVolume const& lv);
+    bool write_primitive(VGUnplacedVolume const* uv, unsigned int id);
+    bool write_polygonal(VGUnplacedVolume const* uv, unsigned int id);
+    std::string volume_name(VGLogicalVolume const& lv) const;
+};
+
+//---------------------------------------------------------------------------//
+Writer::Writer(Converted const& converted,
+               std::ostream& os,
+               GdmlWriteOptions const& options)
+    : converted_{converted}, os_{os}, options_{options}
+{
+    // Volumes reachable from the world, daughters first
+    auto const& ids = converted.ids;
+    volumes_.assign(ids.all_volumes().begin(),
+                    ids.all_volumes().begin() + ids.num_volumes());
+}
+
+//---------------------------------------------------------------------------//
+void Writer::define()
+{
+    os_ << "<define>\n";
+    for (auto const* lv : volumes_)
+    {
+        this->define(lv->GetUnplacedVolume());
+        for (auto const* d : lv->GetDaughters())
+        {
+            this->define(*d->GetTransformation());
+        }
+    }
+    os_ << "</define>\n";
+}
+
+//---------------------------------------------------------------------------//
+void Writer::define(vecgeom::Transformation3D const& xf)
+{
+    auto const d = decompose(xf);
+    if (d.position != Real3{0, 0, 0})
+    {
+        this->define_position(d.position);
+    }
+    if (d.angles != Real3{0, 0, 0})
+    {
+        auto [iter, inserted] = rotations_.insert(
+            {d.angles, static_cast<unsigned int>(rotations_.size())});
+        if (inserted)
+        {
+            os_ << "  <rotation name=\"R" << iter->second << "\" x=\""
+                << d.angles[0] << "\" y=\"" << d.angles[1] << "\" z=\""
+                << d.angles[2] << "\" unit=\"rad\"/>\n";
+        }
+    }
+    if (d.reflected && !wrote_reflection_)
+    {
+        os_ << "  <scale name=\"reflect_z\" x=\"1\" y=\"1\" z=\"-1\"/>\n";
+        wrote_reflection_ = true;
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Define the transforms of constituents and the vertices of shapes
+void Writer::define(VGUnplacedVolume const* uv)
+{
+    auto define_placed = [this](VGPlacedVolume const* pv) {
+        this->define(pv->GetUnplacedVolume());
+        this->define(*pv->GetTransformation());
+    };
+    auto define_boolean = [&define_placed](auto const* b) {
+        if (!b)
+        {
+            return false;
+        }
+        define_placed(b->GetLeft());
+        define_placed(b->GetRight());
+        return true;
+    };
+    using vecgeom::UnplacedBooleanVolume;
+    if (define_boolean(
+            dynamic_cast<UnplacedBooleanVolume<vecgeom::kUnion> const*>(uv))
+        || define_boolean(
+            dynamic_cast<UnplacedBooleanVolume<vecgeom::kSubtraction> const*>(
+                uv))
+        || define_boolean(
+            dynamic_cast<UnplacedBooleanVolume<vecgeom::kIntersection> const*>(
+                uv)))
+    {
+        return;
+    }
+
+    if (auto const* s = dynamic_cast<vecgeom::UnplacedScaledShape const*>(uv))
+    {
+        this->define(s->UnscaledVolume()->GetUnplacedVolume());
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedMultiUnion const*>(uv))
+    {
+        for (std::size_t i = 0; i != s->GetNumberOfSolids(); ++i)
+        {
+            define_placed(s->GetNode(i));
+        }
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedTet const*>(uv))
+    {
+        for (auto const& v : tet_vertices(*s))
+        {
+            this->define_position(to_real3(v));
+        }
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedTessellated const*>(uv))
+    {
+        for (std::size_t i = 0; i != s->GetNFacets(); ++i)
+        {
+            for (auto const& v : s->GetFacet(i)->fVertices)
+            {
+                this->define_position(to_real3(v));
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+//! Define a position (or vertex) if it has not been written yet
+void Writer::define_position(Real3 const& pos)
+{
+    auto [iter, inserted] = positions_.insert(
+        {pos, static_cast<unsigned int>(positions_.size())});
+    if (inserted)
+    {
+        os_ << "  <position name=\"P" << iter->second << "\" x=\"" << pos[0]
+            << "\" y=\"" << pos[1] << "\" z=\"" << pos[2]
+            << "\" unit=\"mm\"/>\n";
+    }
+}
+
+//---------------------------------------------------------------------------//
+void Writer::materials()
+{
+    os_ << "<materials>\n";
+    auto const& mat = converted_.materials;
+
+    std::unordered_set<std::string> elements;
+    for (auto const* m : mat.material)
+    {
+        for (std::size_t i = 0; i != m->GetNumberOfElements(); ++i)
+        {
+            auto const* el = m->GetElement(i);
+            if (!elements.insert(el->GetName()).second)
+            {
+                continue;
+            }
+            os_ << "  <element name=\"" << Escaped{el->GetName()}
+                << "\" Z=\"" << el->GetZ() << "\"><atom unit=\"g/mole\" "
+                << "value=\"" << el->GetA() / (CLHEP::g / CLHEP::mole)
+                << "\"/></element>\n";
+        }
+    }
+
+    for (auto const* m : mat.material)
+    {
+        os_ << "  <material name=\"" << Escaped{m->GetName()} << "\">\n"
+            << "    <D unit=\"g/cm3\" value=\""
+            << m->GetDensity() / (CLHEP::g / CLHEP::cm3) << "\"/>\n";
+        double const* frac = m->GetFractionVector();
+        for (std::size_t i = 0; i != m->GetNumberOfElements(); ++i)
+        {
+            os_ << "    <fraction n=\"" << frac[i] << "\" ref=\""
+                << Escaped{m->GetElement(i)->GetName()} << "\"/>\n";
+        }
+        os_ << "  </material>\n";
+    }
+    os_ << "</materials>\n";
+}
+
+//---------------------------------------------------------------------------//
+void Writer::solids()
+{
+    os_ << "<solids>\n";
+    for (auto const* lv : volumes_)
+    {
+        this->write_solid(lv->GetUnplacedVolume(), *lv);
+    }
+    os_ << "</solids>\n";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a shape (and its constituents) if it has not been written yet.
+ */
+unsigned int
+Writer::write_solid(VGUnplacedVolume const* uv, VGLogicalVolume const& lv)
+{
+    auto iter = solids_.find(uv);
+    if (iter != solids_.end())
+    {
+        return iter->second;
+    }
+
+    if (this->write_boolean<vecgeom::kUnion>(uv, "union", lv)
+        || this->write_boolean<vecgeom::kSubtraction>(uv, "subtraction", lv)
+        || this->write_boolean<vecgeom::kIntersection>(
+            uv, "intersection", lv)
+        || this->write_scaled(uv, lv) || this->write_multi_union(uv, lv))
+    {
+        return solids_.at(uv);
+    }
+
+    unsigned int const id = solids_.size();
+    if (!this->write_primitive(uv, id) && !this->write_polygonal(uv, id))
+    {
+        if (!options_.bbox_fallback)
+        {
+            throw std::runtime_error("cannot export the shape of volume '"
+                                     + this->volume_name(lv)
+                                     + "' to GDML (consider bbox_fallback)");
+        }
+
+        // Centered box enclosing the shape's extent
+        vecgeom::Vector3D<double> lo, hi;
+        uv->Extent(lo, hi);
+        os_ << "  <!-- bounding box of " << Escaped{this->volume_name(lv)}
+            << " -->\n  <box name=\"S" << id << "\"";
+        char const* const labels[] = {" x=\"", " y=\"", " z=\""};
+        for (int i = 0; i < 3; ++i)
+        {
+            os_ << labels[i]
+                << 2 * std::max(std::fabs(lo[i]), std::fabs(hi[i])) << '"';
+        }
+        os_ << " lunit=\"mm\"/>\n";
+    }
+
+    solids_.insert({uv, id});
+    return id;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a shape that has only attributes.
+ *
+ * GDML lengths along z (and the box, trd, para, and trap lengths) are full
+ * lengths, whereas VecGeom stores half lengths; the other GDML lengths are
+ * passed to the Geant4 constructors unchanged.
+ */
+bool Writer::write_primitive(VGUnplacedVolume const* uv, unsigned int id)
+{
+    auto start = [this, id](char const* tag) {
+        os_ << "  <" << tag << " name=\"S" << id << '"';
+    };
+    if (auto const* s = dynamic_cast<vecgeom::UnplacedBox const*>(uv))
+    {
+        start("box");
+        os_ << " x=\"" << 2 * s->x() << "\" y=\"" << 2 * s->y() << "\" z=\""
+            << 2 * s->z() << "\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedTrd const*>(uv))
+    {
+        start("trd");
+        os_ << " x1=\"" << 2 * s->dx1() << "\" x2=\"" << 2 * s->dx2()
+            << "\" y1=\"" << 2 * s->dy1() << "\" y2=\"" << 2 * s->dy2()
+            << "\" z=\"" << 2 * s->dz() << "\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedTube const*>(uv))
+    {
+        start("tube");
+        os_ << " rmin=\"" << s->rmin() << "\" rmax=\"" << s->rmax()
+            << "\" z=\"" << 2 * s->z() << "\" startphi=\"" << s->sphi()
+            << "\" deltaphi=\"" << s->dphi() << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedCutTube const*>(uv))
+    {
+        auto const lo = s->BottomNormal();
+        auto const hi = s->TopNormal();
+        start("cutTube");
+        os_ << " rmin=\"" << s->rmin() << "\" rmax=\"" << s->rmax()
+            << "\" z=\"" << 2 * s->z() << "\" startphi=\"" << s->sphi()
+            << "\" deltaphi=\"" << s->dphi() << "\" lowX=\"" << lo[0]
+            << "\" lowY=\"" << lo[1] << "\" lowZ=\"" << lo[2]
+            << "\" highX=\"" << hi[0] << "\" highY=\"" << hi[1]
+            << "\" highZ=\"" << hi[2] << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedCone const*>(uv))
+    {
+        start("cone");
+        os_ << " rmin1=\"" << s->GetRmin1() << "\" rmax1=\"" << s->GetRmax1()
+            << "\" rmin2=\"" << s->GetRmin2() << "\" rmax2=\""
+            << s->GetRmax2() << "\" z=\"" << 2 * s->GetDz()
+            << "\" startphi=\"" << s->GetSPhi() << "\" deltaphi=\""
+            << s->GetDPhi() << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedOrb const*>(uv))
+    {
+        start("orb");
+        os_ << " r=\"" << s->GetRadius() << "\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedSphere const*>(uv))
+    {
+        start("sphere");
+        os_ << " rmin=\"" << s->GetInnerRadius() << "\" rmax=\""
+            << s->GetOuterRadius() << "\" startphi=\""
+            << s->GetStartPhiAngle() << "\" deltaphi=\""
+            << s->GetDeltaPhiAngle() << "\" starttheta=\""
+            << s->GetStartThetaAngle() << "\" deltatheta=\""
+            << s->GetDeltaThetaAngle() << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedTorus2 const*>(uv))
+    {
+        start("torus");
+        os_ << " rmin=\"" << s->rmin() << "\" rmax=\"" << s->rmax()
+            << "\" rtor=\"" << s->rtor() << "\" startphi=\"" << s->sphi()
+            << "\" deltaphi=\"" << s->dphi() << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedParallelepiped const*>(uv))
+    {
+        start("para");
+        os_ << " x=\"" << 2 * s->GetX() << "\" y=\"" << 2 * s->GetY()
+            << "\" z=\"" << 2 * s->GetZ() << "\" alpha=\"" << s->GetAlpha()
+            << "\" theta=\"" << s->GetTheta() << "\" phi=\"" << s->GetPhi()
+            << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedTrapezoid const*>(uv))
+    {
+        start("trap");
+        os_ << " z=\"" << 2 * s->dz() << "\" theta=\"" << s->GetTheta()
+            << "\" phi=\"" << s->GetPhi() << "\" y1=\"" << 2 * s->dy1()
+            << "\" x1=\"" << 2 * s->dx1() << "\" x2=\"" << 2 * s->dx2()
+            << "\" alpha1=\"" << s->GetAlpha1() << "\" y2=\""
+            << 2 * s->dy2() << "\" x3=\"" << 2 * s->dx3() << "\" x4=\""
+            << 2 * s->dx4() << "\" alpha2=\"" << s->GetAlpha2()
+            << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedGenTrap const*>(uv))
+    {
+        start("arb8");
+        os_ << " dz=\"" << s->GetDZ() << "\"";
+        for (int i = 0; i < 8; ++i)
+        {
+            auto const& v = s->GetVertex(i);
+            os_ << " v" << i + 1 << "x=\"" << v[0] << "\" v" << i + 1
+                << "y=\"" << v[1] << "\"";
+        }
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedTet const*>(uv))
+    {
+        auto const vertices = tet_vertices(*s);
+        start("tet");
+        for (int i = 0; i < 4; ++i)
+        {
+            os_ << " vertex" << i + 1 << "=\"P"
+                << positions_.at(to_real3(vertices[i])) << "\"";
+        }
+    }
+    else if (auto const* s = dynamic_cast<vecgeom::UnplacedHype const*>(uv))
+    {
+        start("hype");
+        os_ << " rmin=\"" << s->GetRmin() << "\" rmax=\"" << s->GetRmax()
+            << "\" inst=\"" << s->GetStIn() << "\" outst=\""
+            << s->GetStOut() << "\" z=\"" << 2 * s->GetDz()
+            << "\" aunit=\"rad\"";
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedParaboloid const*>(uv))
+    {
+        start("paraboloid");
+        os_ << " rlo=\"" << s->GetRlo() << "\" rhi=\"" << s->GetRhi()
+            << "\" dz=\"" << s->GetDz() << "\"";
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedEllipsoid const*>(uv))
+    {
+        start("ellipsoid");
+        os_ << " ax=\"" << s->GetDx() << "\" by=\"" << s->GetDy()
+            << "\" cz=\"" << s->GetDz() << "\" zcut1=\""
+            << s->GetZBottomCut() << "\" zcut2=\"" << s->GetZTopCut()
+            << "\"";
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedEllipticalTube const*>(uv))
+    {
+        start("eltube");
+        os_ << " dx=\"" << s->GetDx() << "\" dy=\"" << s->GetDy()
+            << "\" dz=\"" << s->GetDz() << "\"";
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedEllipticalCone const*>(uv))
+    {
+        // Semi-axes are dimensionless slopes
+        start("elcone");
+        os_ << " dx=\"" << s->GetSemiAxisX() << "\" dy=\""
+            << s->GetSemiAxisY() << "\" zmax=\"" << s->GetZMax()
+            << "\" zcut=\"" << s->GetZTopCut() << "\"";
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+//---------------------------------------------------------------------------//
+/*!
+ * Write a shape defined by a list of planes, points, or facets.
+ */
+bool Writer::write_polygonal(VGUnplacedVolume const* uv, unsigned int id)
+{
+    char const* tag = nullptr;
+    if (auto const* s = dynamic_cast<vecgeom::UnplacedPolycone const*>(uv))
+    {
+        tag = "polycone";
+        std::vector<double> z, rmin, rmax;
+        s->ReconstructSectionArrays(z, rmin, rmax);
+        os_ << "  <" << tag << " name=\"S" << id << "\" startphi=\""
+            << s->GetStartPhi() << "\" deltaphi=\"" << s->GetDeltaPhi()
+            << "\" aunit=\"rad\" lunit=\"mm\">\n";
+        for (std::size_t i = 0; i != z.size(); ++i)
+        {
+            os_ << "    <zplane z=\"" << z[i] << "\" rmin=\"" << rmin[i]
+                << "\" rmax=\"" << rmax[i] << "\"/>\n";
+        }
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedPolyhedron const*>(uv))
+    {
+        // VecGeom and GDML radii are both distances to the flat sides
+        tag = "polyhedra";
+        auto const& z = s->GetZPlanes();
+        auto const& rmin = s->GetRMin();
+        auto const& rmax = s->GetRMax();
+        os_ << "  <" << tag << " name=\"S" << id << "\" startphi=\""
+            << s->GetPhiStart() << "\" deltaphi=\"" << s->GetPhiDelta()
+            << "\" numsides=\"" << s->GetSideCount()
+            << "\" aunit=\"rad\" lunit=\"mm\">\n";
+        for (std::size_t i = 0; i != z.size(); ++i)
+        {
+            os_ << "    <zplane z=\"" << z[i] << "\" rmin=\"" << rmin[i]
+                << "\" rmax=\"" << rmax[i] << "\"/>\n";
+        }
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedGenericPolycone const*>(uv))
+    {
+        tag = "genericPolycone";
+        auto const r = s->GetR();
+        auto const z = s->GetZ();
+        os_ << "  <" << tag << " name=\"S" << id << "\" startphi=\""
+            << s->GetSPhi() << "\" deltaphi=\"" << s->GetDPhi()
+            << "\" aunit=\"rad\" lunit=\"mm\">\n";
+        for (int i = 0; i != s->GetNumRz(); ++i)
+        {
+            os_ << "    <rzpoint r=\"" << r[i] << "\" z=\"" << z[i]
+                << "\"/>\n";
+        }
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedExtruded const*>(uv))
+    {
+        tag = "xtru";
+        os_ << "  <" << tag << " name=\"S" << id << "\" lunit=\"mm\">\n";
+        for (std::size_t i = 0; i != s->GetNVertices(); ++i)
+        {
+            double x, y;
+            s->GetVertex(i, x, y);
+            os_ << "    <twoDimVertex x=\"" << x << "\" y=\"" << y
+                << "\"/>\n";
+        }
+        for (std::size_t i = 0; i != s->GetNSections(); ++i)
+        {
+            auto const section = s->GetSection(i);
+            os_ << "    <section zOrder=\"" << i << "\" zPosition=\""
+                << section.fOrigin[2] << "\" xOffset=\""
+                << section.fOrigin[0] << "\" yOffset=\""
+                << section.fOrigin[1] << "\" scalingFactor=\""
+                << section.fScale << "\"/>\n";
+        }
+    }
+    else if (auto const* s
+             = dynamic_cast<vecgeom::UnplacedTessellated const*>(uv))
+    {
+        tag = "tessellated";
+        os_ << "  <" << tag << " name=\"S" << id << "\" lunit=\"mm\">\n";
+        for (std::size_t i = 0; i != s->GetNFacets(); ++i)
+        {
+            auto const& vertices = s->GetFacet(i)->fVertices;
+            os_ << "    <triangular";
+            for (int j = 0; j < 3; ++j)
+            {
+                os_ << " vertex" << j + 1 << "=\"P"
+                    << positions_.at(to_real3(vertices[j])) << "\"";
+            }
+            os_ << " type=\"ABSOLUTE\"/>\n";
+        }
+    }
+    else
+    {
+        return false;
+    }
+    os_ << "  </" << tag << ">\n";
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+template<vecgeom::BooleanOperation Op>
+bool Writer::write_boolean(VGUnplacedVolume const* uv,
+                           char const* tag,
+                           VGLogicalVolume const& lv)
+{
+    auto const* b
+        = dynamic_cast<vecgeom::UnplacedBooleanVolume<Op> const*>(uv);
+    if (!b)
+    {
+        return false;
+    }
+
+    auto const* left = b->GetLeft();
+    auto const* right = b->GetRight();
+    std::string const left_ref = this->write_constituent(left, lv);
+    std::string const right_ref = this->write_constituent(right, lv);
+
+    unsigned int const id = solids_.size();
+    os_ << "  <" << tag << " name=\"S" << id << "\">\n"
+        << "    <first ref=\"" << left_ref << "\"/>\n"
+        << "    <second ref=\"" << right_ref << "\"/>\n";
+    this->write_refs(*right->GetTransformation(), "    ");
+    this->write_refs(*left->GetTransformation(), "    ", "first");
+    os_ << "  </" << tag << ">\n";
+
+    solids_.insert({uv, id});
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+//! Write a scaled shape after its unscaled constituent
+bool Writer::write_scaled(VGUnplacedVolume const* uv,
+                          VGLogicalVolume const& lv)
+{
+    auto const* s = dynamic_cast<vecgeom::UnplacedScaledShape const*>(uv);
+    if (!s)
+    {
+        return false;
+    }
+
+    unsigned int const unscaled_id
+        = this->write_solid(s->UnscaledVolume()->GetUnplacedVolume(), lv);
+    auto const& scale = s->GetScale();
+
+    unsigned int const id = solids_.size();
+    os_ << "  <scaledSolid name=\"S" << id << "\">\n"
+        << "    <solidref ref=\"S" << unscaled_id << "\"/>\n"
+        << "    <scale name=\"S" << id << "_scale\" x=\"" << scale[0]
+        << "\" y=\"" << scale[1] << "\" z=\"" << scale[2] << "\"/>\n"
+        << "  </scaledSolid>\n";
+
+    solids_.insert({uv, id});
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+//! Write a multi-union after its constituents
+bool Writer::write_multi_union(VGUnplacedVolume const* uv,
+                               VGLogicalVolume const& lv)
+{
+    auto const* s = dynamic_cast<vecgeom::UnplacedMultiUnion const*>(uv);
+    if (!s)
+    {
+        return false;
+    }
+
+    std::vector<std::string> node_refs(s->GetNumberOfSolids());
+    for (std::size_t i = 0; i != node_refs.size(); ++i)
+    {
+        node_refs[i] = this->write_constituent(s->GetNode(i), lv);
+    }
+
+    unsigned int const id = solids_.size();
+    os_ << "  <multiUnion name=\"S" << id << "\">\n";
+    for (std::size_t i = 0; i != node_refs.size(); ++i)
+    {
+        os_ << "    <multiUnionNode name=\"S" << id << '_' << i << "\">\n"
+            << "      <solid ref=\"" << node_refs[i] << "\"/>\n";
+        this->write_refs(*s->GetNode(i)->GetTransformation(), "      ");
+        os_ << "    </multiUnionNode>\n";
+    }
+    os_ << "  </multiUnion>\n";
+
+    solids_.insert({uv, id});
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the shape of a boolean or multi-union constituent.
+ *
+ * GDML booleans and multi-union nodes can't be reflected, so the shape of a
+ * reflected constituent is written as a reflected solid (once per shape) and
+ * the remaining rotation and translation are written with the constituent.
+ */
+std::string Writer::write_constituent(VGPlacedVolume const* pv,
+                                      VGLogicalVolume const& lv)
+{
+    unsigned int const id = this->write_solid(pv->GetUnplacedVolume(), lv);
+    std::string result = "S" + std::to_string(id);
+    if (!decompose(*pv->GetTransformation()).reflected)
+    {
+        return result;
+    }
+
+    if (reflected_solids_.insert(id).second)
+    {
+        os_ << "  <reflectedSolid name=\"" << result << "_reflected\" solid=\""
+            << result << "\" sx=\"1\" sy=\"1\" sz=\"-1\"/>\n";
+    }
+    return result + "_reflected";
+}
+
+//---------------------------------------------------------------------------//
+//! Write references to the defined position and rotation of a transform
+void Writer::write_refs(vecgeom::Transformation3D const& xf,
+                        char const* indent,
+                        char const* prefix)
+{
+    auto const d = decompose(xf);
+    if (d.position != Real3{0, 0, 0})
+    {
+        os_ << indent << '<' << prefix << "positionref ref=\"P"
+            << positions_.at(d.position) << "\"/>\n";
+    }
+    if (d.angles != Real3{0, 0, 0})
+    {
+        os_ << indent << '<' << prefix << "rotationref ref=\"R"
+            << rotations_.at(d.angles) << "\"/>\n";
+    }
+}
+
+//---------------------------------------------------------------------------//
+void Writer::structure()
+{
+    auto const& mat = converted_.materials;
+
+    os_ << "<structure>\n";
+    for (std::size_t id = 0; id != volumes_.size(); ++id)
+    {
+        auto const* lv = volumes_[id];
+        os_ << "  <volume name=\"" << Escaped{this->volume_name(*lv)}
+            << "\">\n";
+        if (id < mat.volume_material.size()
+            && mat.volume_material[id] != MaterialTable::invalid_id)
+        {
+            auto const* m = mat.material[mat.volume_material[id]];
+            os_ << "    <materialref ref=\"" << Escaped{m->GetName()}
+                << "\"/>\n";
+        }
+        os_ << "    <solidref ref=\"S" << solids_.at(lv->GetUnplacedVolume())
+            << "\"/>\n";
+        for (auto const* pv : lv->GetDaughters())
+        {
+            // Geant4 names unlabeled placements after their volume
+            std::string const label{pv->GetLabel()};
+            os_ << "    <physvol";
+            if (!label.empty())
+            {
+                os_ << " name=\"" << Escaped{label} << '"';
+            }
+            os_ << " copynumber=\"" << pv->GetCopyNo() << "\">\n"
+                << "      <volumeref ref=\""
+                << Escaped{this->volume_name(*pv->GetLogicalVolume())}
+                << "\"/>\n";
+            auto const& xf = *pv->GetTransformation();
+            this->write_refs(xf, "      ");
+            if (decompose(xf).reflected)
+            {
+                os_ << "      <scaleref ref=\"reflect_z\"/>\n";
+            }
+            os_ << "    </physvol>\n";
+        }
+        os_ << "  </volume>\n";
+    }
+    os_ << "</structure>\n";
+}
+
+//---------------------------------------------------------------------------//
+void Writer::setup()
+{
+    os_ << "<setup name=\"Default\" version=\"1.0\">\n"
+        << "  <world ref=\""
+        << Escaped{this->volume_name(*converted_.world->GetLogicalVolume())}
+        << "\"/>\n"
+        << "</setup>\n";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a unique name for a volume.
+ *
+ * The VecGeom label is unique, but it may have been cleared at conversion to
+ * save memory; the Geant4 name suffixed by the ID is used instead.
+ */
+std::string Writer::volume_name(VGLogicalVolume const& lv) const
+{
+    std::string result{lv.GetLabel()};
+    if (result.empty())
+    {
+        auto const id = converted_.ids.id(lv);
+        auto const& vn = converted_.volume_names;
+        if (id < vn.size() && vn[id] != NamePool::invalid_id)
+        {
+            result = converted_.names[vn[id]];
+        }
+        result += "@" + std::to_string(id);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the converted VecGeom geometry as GDML.
+ */
+void write_gdml(Converted const& converted, std::ostream& os)
+{
+    write_gdml(converted, os, {});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write with custom options.
+ *
+ * The file is streamed in a single pass over the volumes for each GDML
+ * section without building a document in memory. Volumes are written in
+ * order of volume ID, and solids, positions, and rotations shared by
+ * several volumes or placements are defined once and referenced by name.
+ * Materials (with their elements) are written only if the result has a
+ * material table, i.e. if it was converted from Geant4.
+ *
+ * Every shape created by the Geant4 solid converter is supported, including
+ * booleans, multi-unions, and scaled shapes; reflected constituents of
+ * booleans and multi-unions are written as reflected solids. Other shapes
+ * (such as wrapped Geant4 solids) cause an exception unless \c bbox_fallback
+ * is set.
+ */
+void write_gdml(Converted const& converted,
+                std::ostream& os,
+                GdmlWriteOptions const& options)
+{
+    if (!converted.world)
+    {
+        throw std::invalid_argument("cannot write an empty geometry");
+    }
+
+    auto const orig_precision
+        = os.precision(std::numeric_limits<double>::max_digits10);
+
+    Writer write{converted, os, options};
+    os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<gdml xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+          "xsi:noNamespaceSchemaLocation=\"http://service-spi.web.cern.ch/"
+          "service-spi/app/releases/GDML/schema/gdml.xsd\">\n";
+    write.define();
+    write.materials();
+    write.solids();
+    write.structure();
+    write.setup();
+    os << "</gdml>\n";
+
+    os.precision(orig_precision);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,34 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GdmlWriter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+
+#include "G4VG.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+//! Options for exporting a converted geometry
+struct GdmlWriteOptions
+{
+    //! Replace shapes that cannot be exported with their bounding boxes
+    bool bbox_fallback{false};
+};
+
+//---------------------------------------------------------------------------//
+// Write the converted VecGeom geometry as GDML
+void write_gdml(Converted const& converted, std::ostream& os);
+
+// Write with custom options
+void write_gdml(Converted const& converted,
+                std::ostream& os,
+                GdmlWriteOptions const& options);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
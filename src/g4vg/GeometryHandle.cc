@@ -0,0 +1,208 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GeometryHandle.cc
+//---------------------------------------------------------------------------//
+#include "GeometryHandle.hh"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Superseded versions that are no longer referenced.
+ *
+ * This is shared with the deleters of published versions so that a reader
+ * releasing the last reference never deletes VecGeom objects itself, unless
+ * the handle is already gone.
+ */
+struct GeometryHandle::Retired
+{
+    std::mutex mutex;
+    std::vector<Converted const*> versions;
+
+    void push(Converted const* converted)
+    {
+        std::lock_guard<std::mutex> scoped_lock{mutex};
+        versions.push_back(converted);
+    }
+
+    std::size_t size()
+    {
+        std::lock_guard<std::mutex> scoped_lock{mutex};
+        return versions.size();
+    }
+
+    // Delete all retired versions outside the lock
+    std::size_t clear()
+    {
+        std::vector<Converted const*> temp;
+        {
+            std::lock_guard<std::mutex> scoped_lock{mutex};
+            temp.swap(versions);
+        }
+        for (auto const* converted : temp)
+        {
+            delete converted;
+        }
+        return temp.size();
+    }
+
+    ~Retired() { this->clear(); }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with default conversion options.
+ */
+GeometryHandle::GeometryHandle() : GeometryHandle{Options{}} {}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with custom conversion options.
+ */
+GeometryHandle::GeometryHandle(Options options)
+    : options_{std::move(options)}, retired_{std::make_shared<Retired>()}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for any conversion and delete unused versions.
+ *
+ * Versions still held by readers are deleted when their last reference is
+ * dropped.
+ */
+GeometryHandle::~GeometryHandle()
+{
+    std::lock_guard<std::mutex> scoped_lock{update_mutex_};
+    if (pending_.valid())
+    {
+        pending_.wait();
+    }
+    std::atomic_store(&current_, SPConstConverted{});
+    retired_->clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a world in the background and publish it when done.
+ *
+ * Updates are published in the order they are requested. The returned
+ * future holds the new version, or rethrows the conversion error; a failed
+ * update leaves the current version in place.
+ */
+auto GeometryHandle::update(G4VPhysicalVolume const* world)
+    -> FutureConverted
+{
+    if (!world)
+    {
+        throw std::invalid_argument("cannot convert a null world volume");
+    }
+
+    std::lock_guard<std::mutex> scoped_lock{update_mutex_};
+    auto task = [this, world, previous = pending_]() mutable {
+        if (previous.valid())
+        {
+            // Publish versions in order
+            previous.wait();
+        }
+        // The task outlives this call: don't keep the previous version alive
+        previous = {};
+        retired_->clear();
+        auto result = this->make_version(convert(world, options_));
+        this->publish_impl(result);
+        return result;
+    };
+    pending_ = std::async(std::launch::async, std::move(task)).share();
+    return pending_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Publish an already converted geometry.
+ *
+ * The geometry replaces the current version immediately, even if an update
+ * is in progress.
+ */
+auto GeometryHandle::publish(Converted&& converted) -> SPConstConverted
+{
+    auto result = this->make_version(std::move(converted));
+    this->publish_impl(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the current version, or null if none has been published.
+ */
+auto GeometryHandle::get() const -> SPConstConverted
+{
+    return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of superseded versions waiting to be deleted.
+ */
+std::size_t GeometryHandle::num_retired() const
+{
+    return retired_->size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for pending updates, then delete retired versions.
+ *
+ * This returns the number of versions deleted.
+ */
+std::size_t GeometryHandle::reclaim()
+{
+    std::lock_guard<std::mutex> scoped_lock{update_mutex_};
+    if (pending_.valid())
+    {
+        pending_.wait();
+    }
+    return retired_->clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Share a conversion result, retiring it when it is no longer used.
+ */
+auto GeometryHandle::make_version(Converted&& converted) const
+    -> SPConstConverted
+{
+    std::weak_ptr<Retired> retired = retired_;
+    return SPConstConverted{
+        new Converted(std::move(converted)),
+        [retired = std::move(retired)](Converted const* c) {
+            if (auto r = retired.lock())
+            {
+                r->push(c);
+            }
+            else
+            {
+                delete c;
+            }
+        }};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the current version.
+ */
+void GeometryHandle::publish_impl(SPConstConverted converted)
+{
+    std::atomic_store_explicit(
+        &current_, std::move(converted), std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
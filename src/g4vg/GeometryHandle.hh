@@ -0,0 +1,117 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GeometryHandle.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "G4VG.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Swap in a newly converted geometry without pausing its readers.
+ *
+ * \c update converts a Geant4 world on a background thread and then
+ * atomically publishes the result (the VecGeom world and all of its ID
+ * tables, as a single immutable \c Converted ). Readers call \c get to take a
+ * reference-counted pointer to the current version: this never waits for a
+ * conversion, and a reader keeps a consistent geometry for as long as it
+ * holds the pointer.
+ *
+ * When the last reference to a superseded version is dropped, it is retired
+ * rather than deleted, since deleting VecGeom volumes modifies the global
+ * \c GeoManager and could race with a conversion. Retired versions are
+ * deleted at the start of the next update, by \c reclaim , or when the
+ * handle is destroyed.
+ *
+ * Example for swapping geometry between runs:
+ * \code
+   // Service thread
+   handle.update(new_world);
+
+   // Event loop, each event
+   auto geo = handle.get();
+   navigate(*geo);
+ * \endcode
+ *
+ * Readers must use the pointers and tables in their version rather than
+ * looking up volumes through the \c GeoManager , whose registry changes
+ * during a conversion. VecGeom IDs continue to increase from one version to
+ * the next, but the IDs in \c Converted::ids depend only on the geometry.
+ * The Geant4 world must not be modified while it is converted.
+ */
+class GeometryHandle
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstConverted = std::shared_ptr<Converted const>;
+    using FutureConverted = std::shared_future<SPConstConverted>;
+    //!@}
+
+  public:
+    // Construct with default conversion options
+    GeometryHandle();
+
+    // Construct with custom conversion options
+    explicit GeometryHandle(Options options);
+
+    // Wait for any conversion and delete unused versions
+    ~GeometryHandle();
+
+    //!@{
+    //! Prevent copying and moving
+    GeometryHandle(GeometryHandle const&) = delete;
+    GeometryHandle& operator=(GeometryHandle const&) = delete;
+    //!@}
+
+    // Convert a world in the background and publish it when done
+    FutureConverted update(G4VPhysicalVolume const* world);
+
+    // Publish an already converted geometry
+    SPConstConverted publish(Converted&& converted);
+
+    // Get the current version, or null if none has been published
+    SPConstConverted get() const;
+
+    //! Number of versions published
+    std::size_t version() const
+    {
+        return version_.load(std::memory_order_acquire);
+    }
+
+    //! Whether a geometry has been published
+    explicit operator bool() const { return static_cast<bool>(this->get()); }
+
+    // Number of superseded versions waiting to be deleted
+    std::size_t num_retired() const;
+
+    // Wait for pending updates, then delete retired versions
+    std::size_t reclaim();
+
+  private:
+    struct Retired;
+
+    Options options_;
+    std::shared_ptr<Retired> retired_;
+    SPConstConverted current_;  // Only accessed atomically
+    std::atomic<std::size_t> version_{0};
+    std::mutex update_mutex_;
+    FutureConverted pending_;
+
+    SPConstConverted make_version(Converted&& converted) const;
+    void publish_impl(SPConstConverted converted);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/LinearTree.cc
+//---------------------------------------------------------------------------//
+#include "LinearTree.hh"
+
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "VolumeIds.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Flatten the placement hierarchy below a world volume.
+ *
+ * Daughters are visited in the order of \c LogicalVolume::GetDaughters .
+ */
+LinearTree build_linear_tree(VolumeIds const& ids)
+{
+    LinearTree result;
+    auto add_node = [&result, &ids](vecgeom::VPlacedVolume const* pv,
+                                    unsigned int parent,
+                                    std::size_t depth) {
+        unsigned int const node = result.size();
+        result.placed.push_back(ids.id(*pv));
+        result.volume.push_back(ids.id(*pv->GetLogicalVolume()));
+        result.parent.push_back(parent);
+        result.skip.push_back(0);
+        result.depth.push_back(static_cast<unsigned short>(depth));
+        return node;
+    };
+
+    struct Frame
+    {
+        vecgeom::VPlacedVolume const* pv;
+        unsigned int node;
+        std::size_t next_daughter;
+    };
+
+    auto const* world = ids.world();
+    std::vector<Frame> stack;
+    stack.push_back({world, add_node(world, LinearTree::no_parent, 0), 0});
+    while (!stack.empty())
+    {
+        Frame& top = stack.back();
+        auto const& daughters = top.pv->GetLogicalVolume()->GetDaughters();
+        if (top.next_daughter == daughters.size())
+        {
+            // Subtree is complete
+            result.skip[top.node] = result.size();
+            stack.pop_back();
+            continue;
+        }
+
+        auto const* pv = daughters[top.next_daughter++];
+        unsigned int const node = add_node(pv, top.node, stack.size());
+        stack.push_back({pv, node, 0});
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
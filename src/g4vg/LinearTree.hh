@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/LinearTree.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+namespace g4vg
+{
+class VolumeIds;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Placement hierarchy flattened into a pre-order array with skip links.
+ *
+ * Each node is one unique path through the placement tree (i.e. one
+ * touchable), with node 0 the world. A node's subtree is the contiguous range
+ * from the node up to (but not including) \c skip[node], so whole-geometry
+ * passes need no stack:
+ * \code
+   for (unsigned int i = 0; i != tree.size();)
+   {
+       if (!visit(i))
+       {
+           i = tree.skip[i];  // Prune the subtree
+           continue;
+       }
+       ++i;
+   }
+ * \endcode
+ * and independent subtrees can be processed in parallel by index range.
+ *
+ * The number of nodes is the number of touchables, which can be much larger
+ * than the number of placements for deeply nested repeated structures.
+ */
+struct LinearTree
+{
+    //! Parent of the world node
+    static constexpr unsigned int no_parent = static_cast<unsigned int>(-1);
+
+    //!@{
+    //! \name Per-node data
+    std::vector<unsigned int> placed;  //!< Placement ID
+    std::vector<unsigned int> volume;  //!< Logical volume ID
+    std::vector<unsigned int> parent;  //!< Parent node
+    std::vector<unsigned int> skip;  //!< End of this node's subtree
+    std::vector<unsigned short> depth;  //!< Zero for the world
+    //!@}
+
+    //! Number of nodes
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(placed.size());
+    }
+
+    //! Whether the tree is empty
+    bool empty() const { return placed.empty(); }
+};
+
+//---------------------------------------------------------------------------//
+// Flatten the placement hierarchy below a world volume
+LinearTree build_linear_tree(VolumeIds const& ids);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
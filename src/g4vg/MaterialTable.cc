@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/MaterialTable.cc
+//---------------------------------------------------------------------------//
+#include "MaterialTable.hh"
+
+#include <unordered_map>
+#include <G4IonisParamMat.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Material.hh>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Build a material table from the Geant4 volume of each volume ID.
+ *
+ * Each unique Geant4 material is stored once, in order of its first use by
+ * increasing volume ID. Null volumes have no material.
+ */
+MaterialTable build_material_table(
+    std::vector<G4LogicalVolume const*> const& logical_volumes)
+{
+    MaterialTable result;
+    result.volume_material.assign(logical_volumes.size(),
+                                  MaterialTable::invalid_id);
+
+    std::unordered_map<G4Material const*, unsigned int> mat_ids;
+    for (std::size_t id = 0; id != logical_volumes.size(); ++id)
+    {
+        G4LogicalVolume const* lv = logical_volumes[id];
+        G4Material const* mat = lv ? lv->GetMaterial() : nullptr;
+        if (!mat)
+        {
+            continue;
+        }
+
+        auto [iter, inserted] = mat_ids.insert({mat, result.size()});
+        if (inserted)
+        {
+            result.material.push_back(mat);
+            result.density.push_back(mat->GetDensity());
+            result.electron_density.push_back(mat->GetElectronDensity());
+            result.radiation_length.push_back(mat->GetRadlen());
+            result.nuclear_interaction_length.push_back(
+                mat->GetNuclearInterLength());
+            result.mean_excitation_energy.push_back(
+                mat->GetIonisation()->GetMeanExcitationEnergy());
+        }
+        result.volume_material[id] = iter->second;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
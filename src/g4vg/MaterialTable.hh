@@ -0,0 +1,70 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/MaterialTable.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+class G4LogicalVolume;
+class G4Material;
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Deduplicated material properties indexed by logical volume ID.
+ *
+ * Material properties are stored as a structure of arrays indexed by a dense
+ * material ID, and \c volume_material maps each volume ID to its material
+ * ID. Finding a property of the current volume's material is thus two array
+ * loads with no pointer chasing through Geant4:
+ * \code
+   auto mat_id = table.volume_material[vol_id];
+   double radlen = table.radiation_length[mat_id];
+ * \endcode
+ *
+ * Materials are numbered in order of first use by increasing volume ID, so
+ * the numbering is reproducible for a given geometry. Volumes without a
+ * Geant4 material map to \c invalid_id .
+ *
+ * All quantities are in the native Geant4 unit system.
+ */
+struct MaterialTable
+{
+    //! Sentinel for a volume without a material
+    static constexpr unsigned int invalid_id = static_cast<unsigned int>(-1);
+
+    //!@{
+    //! \name Per-material properties
+    std::vector<G4Material const*> material;  //!< Source Geant4 material
+    std::vector<double> density;  //!< Mass density
+    std::vector<double> electron_density;  //!< Electrons per unit volume
+    std::vector<double> radiation_length;
+    std::vector<double> nuclear_interaction_length;
+    std::vector<double> mean_excitation_energy;
+    //!@}
+
+    //! Material ID for each volume ID
+    std::vector<unsigned int> volume_material;
+
+    //! Number of unique materials
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(material.size());
+    }
+
+    //! Whether no materials are present
+    bool empty() const { return material.empty(); }
+};
+
+//---------------------------------------------------------------------------//
+// Build a material table from the Geant4 volume of each volume ID
+MaterialTable build_material_table(
+    std::vector<G4LogicalVolume const*> const& logical_volumes);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
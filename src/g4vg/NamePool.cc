@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NamePool.cc
+//---------------------------------------------------------------------------//
+#include "NamePool.hh"
+
+#include <functional>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add a string if it's not already present, returning its ID.
+ */
+unsigned int NamePool::insert(std::string_view s)
+{
+    if (ids_.empty() && !this->empty())
+    {
+        this->build_index();
+    }
+
+    auto const hash = std::hash<std::string_view>{}(s);
+    auto [first, last] = ids_.equal_range(hash);
+    for (; first != last; ++first)
+    {
+        if ((*this)[first->second] == s)
+        {
+            return first->second;
+        }
+    }
+
+    unsigned int const id = this->size();
+    chars_.append(s.data(), s.size());
+    offsets_.push_back(static_cast<unsigned int>(chars_.size()));
+    ids_.insert({hash, id});
+    return id;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the ID of a string, or invalid_id if not present.
+ */
+unsigned int NamePool::find(std::string_view s) const
+{
+    if (ids_.empty())
+    {
+        // Index was released by compact(), or pool is empty
+        for (unsigned int id = 0; id != this->size(); ++id)
+        {
+            if ((*this)[id] == s)
+            {
+                return id;
+            }
+        }
+        return invalid_id;
+    }
+
+    auto [first, last] = ids_.equal_range(std::hash<std::string_view>{}(s));
+    for (; first != last; ++first)
+    {
+        if ((*this)[first->second] == s)
+        {
+            return first->second;
+        }
+    }
+    return invalid_id;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release the lookup index and excess capacity.
+ */
+void NamePool::compact()
+{
+    decltype(ids_){}.swap(ids_);
+    chars_.shrink_to_fit();
+    offsets_.shrink_to_fit();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Approximate heap memory used by the pool.
+ *
+ * The hash table size is estimated assuming one node per entry plus one
+ * bucket pointer.
+ */
+std::size_t NamePool::memory_bytes() const
+{
+    using Node = std::pair<std::size_t const, unsigned int>;
+    return chars_.capacity() + offsets_.capacity() * sizeof(unsigned int)
+           + ids_.size() * (sizeof(Node) + 2 * sizeof(void*))
+           + ids_.bucket_count() * sizeof(void*);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Rebuild the hash index from the stored strings.
+ */
+void NamePool::build_index()
+{
+    ids_.reserve(this->size());
+    for (unsigned int id = 0; id != this->size(); ++id)
+    {
+        ids_.insert({std::hash<std::string_view>{}((*this)[id]), id});
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
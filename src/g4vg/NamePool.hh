@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NamePool.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interned strings stored contiguously in a single buffer.
+ *
+ * Each unique string is stored once and identified by a dense ID in order of
+ * insertion. Lookups return views into the shared buffer, which remain valid
+ * until the next insertion.
+ *
+ * Large geometries often reuse a handful of names for many volumes (e.g.
+ * replicated detector modules), so interning avoids one heap allocation per
+ * volume.
+ *
+ * Once construction is complete, \c compact drops the hash index: lookups by
+ * ID are unaffected, lookups by name become a linear search, and the index is
+ * rebuilt if another string is inserted.
+ */
+class NamePool
+{
+  public:
+    //! Sentinel for a missing name
+    static constexpr unsigned int invalid_id = static_cast<unsigned int>(-1);
+
+  public:
+    // Add a string if it's not already present, returning its ID
+    unsigned int insert(std::string_view s);
+
+    // Find the ID of a string, or invalid_id if not present
+    unsigned int find(std::string_view s) const;
+
+    //! Get the string corresponding to an ID
+    std::string_view operator[](unsigned int id) const
+    {
+        return std::string_view{chars_}.substr(
+            offsets_[id], offsets_[id + 1] - offsets_[id]);
+    }
+
+    //! Number of unique strings
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(offsets_.size() - 1);
+    }
+
+    //! Whether no strings are stored
+    bool empty() const { return offsets_.size() == 1; }
+
+    // Release the lookup index and excess capacity
+    void compact();
+
+    // Approximate heap memory used by the pool
+    std::size_t memory_bytes() const;
+
+  private:
+    std::string chars_;
+    std::vector<unsigned int> offsets_{0};
+    std::unordered_multimap<std::size_t, unsigned int> ids_;
+
+    void build_index();
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NavigationTables.cc
+//---------------------------------------------------------------------------//
+#include "NavigationTables.hh"
+
+#include <algorithm>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "VolumeIds.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Build navigation tables for all volumes reachable from the world.
+ */
+NavigationTables build_navigation_tables(VolumeIds const& ids)
+{
+    auto const num_volumes = ids.num_volumes();
+    auto const num_daughters = ids.num_placements() - 1;
+
+    NavigationTables result;
+    result.daughter_offsets.reserve(num_volumes + 1);
+    result.shape.reserve(num_volumes);
+    result.daughter_volume.reserve(num_daughters);
+    result.daughter_transform.reserve(num_daughters
+                                      * NavigationTables::transform_size);
+    result.daughter.reserve(num_daughters);
+
+    result.daughter_offsets.push_back(0);
+    for (unsigned int id = 0; id != num_volumes; ++id)
+    {
+        auto const* lv = ids.volume(id);
+        result.shape.push_back(lv->GetUnplacedVolume());
+        for (auto const* pv : lv->GetDaughters())
+        {
+            auto const* xf = pv->GetTransformation();
+            for (int i = 0; i < 3; ++i)
+            {
+                result.daughter_transform.push_back(xf->Translation(i));
+            }
+            for (int i = 0; i < 9; ++i)
+            {
+                result.daughter_transform.push_back(xf->Rotation(i));
+            }
+            result.daughter_volume.push_back(
+                ids.id(*pv->GetLogicalVolume()));
+            result.daughter.push_back(pv);
+        }
+        result.daughter_offsets.push_back(
+            static_cast<unsigned int>(result.daughter.size()));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Refresh the transforms of moved placements.
+ *
+ * The selection is indexed by placement ID, which is also the daughter
+ * offset. This returns the number of daughters updated.
+ */
+std::size_t update_navigation_tables(std::vector<bool> const& moved,
+                                     NavigationTables* tables)
+{
+    std::size_t result = 0;
+    auto const num_moved = std::min(moved.size(), tables->daughter.size());
+    for (std::size_t i = 0; i != num_moved; ++i)
+    {
+        if (!moved[i])
+        {
+            continue;
+        }
+        auto const* xf = tables->daughter[i]->GetTransformation();
+        double* t = tables->daughter_transform.data()
+                    + i * NavigationTables::transform_size;
+        for (int j = 0; j < 3; ++j)
+        {
+            t[j] = xf->Translation(j);
+        }
+        for (int j = 0; j < 9; ++j)
+        {
+            t[3 + j] = xf->Rotation(j);
+        }
+        ++result;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
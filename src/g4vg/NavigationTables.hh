@@ -0,0 +1,92 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NavigationTables.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace vecgeom
+{
+inline namespace cxx
+{
+class VPlacedVolume;
+class VUnplacedVolume;
+}  // namespace cxx
+}  // namespace vecgeom
+
+namespace g4vg
+{
+class VolumeIds;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Navigation-hot data for all converted volumes in contiguous arrays.
+ *
+ * A daughter loop only needs each daughter's shape, transform, and volume ID,
+ * but VecGeom stores these behind separate heap objects (placed volume,
+ * transformation, logical volume) interleaved with names and user data. These
+ * tables pack the hot fields so that scanning the daughters of a mother
+ * touches consecutive memory:
+ * \code
+   auto const* offsets = t.daughter_offsets.data();
+   for (auto i = offsets[mother]; i != offsets[mother + 1]; ++i)
+   {
+       double const* xf = &t.daughter_transform[i * transform_size];
+       // ... transform point, test t.shape[t.daughter_volume[i]]
+   }
+ * \endcode
+ *
+ * Cold metadata lives elsewhere in \c Converted : names in \c names , Geant4
+ * pointers in \c volumes , and attributes in \c attributes . Acceleration
+ * structures (BVH) are created by VecGeom when the geometry is closed.
+ *
+ * Daughters are stored in mother volume ID order using the compressed sparse
+ * row layout, in the same order as \c LogicalVolume::GetDaughters , so the
+ * daughter offset of each placement is its placement ID.
+ */
+struct NavigationTables
+{
+    //! Number of values per transform: translation (3) then rotation (9)
+    static constexpr unsigned int transform_size = 12;
+
+    //!@{
+    //! \name Per-LV data (indexed by volume ID)
+    std::vector<unsigned int> daughter_offsets;  //!< Size is num LV + 1
+    std::vector<vecgeom::VUnplacedVolume const*> shape;
+    //!@}
+
+    //!@{
+    //! \name Per-daughter data (indexed by daughter offset)
+    std::vector<unsigned int> daughter_volume;  //!< Daughter volume ID
+    std::vector<double> daughter_transform;  //!< Mother-to-daughter
+    std::vector<vecgeom::VPlacedVolume const*> daughter;
+    //!@}
+
+    //! Number of logical volumes
+    unsigned int num_volumes() const
+    {
+        return static_cast<unsigned int>(shape.size());
+    }
+
+    //! Number of placements
+    unsigned int num_daughters() const
+    {
+        return static_cast<unsigned int>(daughter.size());
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Build navigation tables for all volumes reachable from the world
+NavigationTables build_navigation_tables(VolumeIds const& ids);
+
+// Refresh the transforms of moved placements
+std::size_t update_navigation_tables(std::vector<bool> const& moved,
+                                     NavigationTables* tables);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
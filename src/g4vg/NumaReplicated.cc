@@ -0,0 +1,175 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NumaReplicated.cc
+//---------------------------------------------------------------------------//
+#include "NumaReplicated.hh"
+
+#include <exception>
+#include <limits>
+#include <thread>
+
+#ifdef G4VG_USE_NUMA
+#    include <numa.h>
+#    include <sched.h>
+#endif
+
+namespace g4vg
+{
+#ifdef G4VG_USE_NUMA
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * System IDs of the NUMA nodes that have memory.
+ *
+ * Node IDs may be sparse, and CPU-only nodes cannot hold a replica, so
+ * replicas are indexed by position in this list.
+ */
+std::vector<int> const& memory_nodes()
+{
+    static std::vector<int> const result = [] {
+        std::vector<int> nodes;
+        if (::numa_available() >= 0)
+        {
+            for (int node = 0; node <= ::numa_max_node(); ++node)
+            {
+                if (::numa_node_size64(node, nullptr) > 0)
+                {
+                    nodes.push_back(node);
+                }
+            }
+        }
+        return nodes;
+    }();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether NUMA-local allocation is both compiled in and usable.
+ *
+ * This is evaluated once per process so that the node count and the nodes
+ * of the replicas never change.
+ */
+bool use_numa()
+{
+    static bool const result = memory_nodes().size() > 1;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Index of the memory node closest to a system node.
+ */
+int nearest_memory_node(int system_node)
+{
+    auto const& nodes = memory_nodes();
+    int result = 0;
+    int min_distance = std::numeric_limits<int>::max();
+    for (int i = 0; i != static_cast<int>(nodes.size()); ++i)
+    {
+        int const distance = ::numa_distance(system_node, nodes[i]);
+        if (distance > 0 && distance < min_distance)
+        {
+            min_distance = distance;
+            result = i;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of NUMA nodes used for replication.
+ *
+ * Only nodes with memory are counted. The nodes used by g4vg are numbered
+ * densely from zero, so they may differ from the system node IDs.
+ */
+int numa_node_count()
+{
+#ifdef G4VG_USE_NUMA
+    if (use_numa())
+    {
+        return static_cast<int>(memory_nodes().size());
+    }
+#endif
+    return 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * NUMA node of the calling thread.
+ *
+ * The node is looked up from the CPU the thread is running on the first time
+ * this is called and cached thereafter, so threads should be pinned (as
+ * Geant4 does with \c G4MTRunManager::SetPinAffinity) before first use. A
+ * thread on a node without memory uses the nearest node that has memory.
+ */
+int numa_local_node()
+{
+#ifdef G4VG_USE_NUMA
+    if (use_numa())
+    {
+        thread_local int const node = [] {
+            int cpu = ::sched_getcpu();
+            int result = (cpu >= 0 ? ::numa_node_of_cpu(cpu) : 0);
+            return nearest_memory_node(result >= 0 ? result : 0);
+        }();
+        return node;
+    }
+#endif
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Run a function on a thread bound to the CPUs and memory of a NUMA node.
+ *
+ * Memory that the function allocates and first writes comes from the node,
+ * so containers copied inside it stay local after they are moved out.
+ * Exceptions are rethrown on the calling thread. Without NUMA support the
+ * function is called directly.
+ */
+void numa_run_on_node(int node, std::function<void()> const& func)
+{
+#ifdef G4VG_USE_NUMA
+    if (use_numa())
+    {
+        int const system_node = memory_nodes().at(node);
+        std::exception_ptr error;
+        std::thread thread{[&] {
+            try
+            {
+                ::numa_run_on_node(system_node);
+                auto* mask = ::numa_allocate_nodemask();
+                ::numa_bitmask_setbit(mask, system_node);
+                ::numa_set_membind(mask);
+                ::numa_free_nodemask(mask);
+                func();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        }};
+        thread.join();
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+        return;
+    }
+#endif
+    (void)node;
+    func();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,47 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NumaReplicated.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+// Number of NUMA nodes used for replication (one if NUMA is unavailable)
+int numa_node_count();
+
+// NUMA node of the calling thread, cached on first use
+int numa_local_node();
+
+// Run a function on a thread bound to the CPUs and memory of a NUMA node
+void numa_run_on_node(int node, std::function<void()> const& func);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy a value, including the heap data it owns, onto every NUMA node.
+ *
+ * Each copy is made on a thread bound to its node, so the buffers of
+ * containers (such as the vectors of the converted tables) are allocated in
+ * that node's memory. The result is indexed by \c numa_local_node .
+ */
+template<class T>
+std::vector<T> numa_replicate(T const& value)
+{
+    std::vector<T> result(numa_node_count());
+    for (int node = 0; node != numa_node_count(); ++node)
+    {
+        numa_run_on_node(node, [&result, &value, node] {
+            result[node] = value;
+        });
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
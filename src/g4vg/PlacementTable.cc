@@ -0,0 +1,160 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/PlacementTable.cc
+//---------------------------------------------------------------------------//
+#include "PlacementTable.hh"
+
+#include <algorithm>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "VolumeIds.hh"
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using VGVector = vecgeom::Vector3D<vecgeom::Precision>;
+
+//---------------------------------------------------------------------------//
+//! Bound the transformed corners of a placement's local bounding box
+void bounding_box(vecgeom::VPlacedVolume const& pv,
+                  VGVector* lower,
+                  VGVector* upper)
+{
+    auto const* xf = pv.GetTransformation();
+    VGVector local_lo;
+    VGVector local_hi;
+    pv.GetUnplacedVolume()->Extent(local_lo, local_hi);
+    *lower = VGVector{
+        vecgeom::kInfLength, vecgeom::kInfLength, vecgeom::kInfLength};
+    *upper = -*lower;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        VGVector const local{
+            corner & 1 ? local_hi[0] : local_lo[0],
+            corner & 2 ? local_hi[1] : local_lo[1],
+            corner & 4 ? local_hi[2] : local_lo[2],
+        };
+        VGVector const pos = xf->InverseTransform(local);
+        for (int i = 0; i < 3; ++i)
+        {
+            (*lower)[i] = std::min((*lower)[i], pos[i]);
+            (*upper)[i] = std::max((*upper)[i], pos[i]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the placement table for all volumes reachable from the world.
+ */
+PlacementTable build_placement_table(VolumeIds const& ids)
+{
+    auto const num_volumes = ids.num_volumes();
+    auto const num_rows = ids.num_placements() - 1;
+
+    PlacementTable result;
+    auto reserve = [num_rows](auto& vec) { vec.reserve(num_rows); };
+    reserve(result.mother);
+    reserve(result.volume);
+    reserve(result.placed);
+    reserve(result.copy_number);
+    for (int i = 0; i < 3; ++i)
+    {
+        reserve(result.translation[i]);
+        reserve(result.bbox_lower[i]);
+        reserve(result.bbox_upper[i]);
+    }
+    for (auto& r : result.rotation)
+    {
+        reserve(r);
+    }
+
+    result.offsets.reserve(num_volumes + 1);
+    result.offsets.push_back(0);
+    for (unsigned int mother_id = 0; mother_id != num_volumes; ++mother_id)
+    {
+        for (auto const* pv : ids.volume(mother_id)->GetDaughters())
+        {
+            result.mother.push_back(mother_id);
+            result.volume.push_back(ids.id(*pv->GetLogicalVolume()));
+            result.placed.push_back(ids.id(*pv));
+            result.copy_number.push_back(pv->GetCopyNo());
+
+            auto const* xf = pv->GetTransformation();
+            for (int i = 0; i < 3; ++i)
+            {
+                result.translation[i].push_back(xf->Translation(i));
+            }
+            for (int i = 0; i < 9; ++i)
+            {
+                result.rotation[i].push_back(xf->Rotation(i));
+            }
+
+            VGVector lower;
+            VGVector upper;
+            bounding_box(*pv, &lower, &upper);
+            for (int i = 0; i < 3; ++i)
+            {
+                result.bbox_lower[i].push_back(lower[i]);
+                result.bbox_upper[i].push_back(upper[i]);
+            }
+        }
+        result.offsets.push_back(result.size());
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Refresh the transforms and bounding boxes of moved placements.
+ *
+ * The selection is indexed by placement ID, which is also the row. This
+ * returns the number of rows updated.
+ */
+std::size_t update_placement_table(VolumeIds const& ids,
+                                   std::vector<bool> const& moved,
+                                   PlacementTable* table)
+{
+    std::size_t result = 0;
+    auto const num_moved = std::min<std::size_t>(moved.size(), table->size());
+    for (unsigned int row = 0; row != num_moved; ++row)
+    {
+        if (!moved[row])
+        {
+            continue;
+        }
+        auto const* pv = ids.placement(row);
+        auto const* xf = pv->GetTransformation();
+        for (int i = 0; i < 3; ++i)
+        {
+            table->translation[i][row] = xf->Translation(i);
+        }
+        for (int i = 0; i < 9; ++i)
+        {
+            table->rotation[i][row] = xf->Rotation(i);
+        }
+
+        VGVector lower;
+        VGVector upper;
+        bounding_box(*pv, &lower, &upper);
+        for (int i = 0; i < 3; ++i)
+        {
+            table->bbox_lower[i][row] = lower[i];
+            table->bbox_upper[i][row] = upper[i];
+        }
+        ++result;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
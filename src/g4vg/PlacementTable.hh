@@ -0,0 +1,76 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/PlacementTable.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace g4vg
+{
+class VolumeIds;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Structure-of-arrays view of all daughter placements.
+ *
+ * Each row is one placement; every field is stored in its own contiguous
+ * array of plain numbers so that kernels can process many siblings at once
+ * (e.g. rejecting daughters whose bounding box doesn't contain a point)
+ * without dereferencing \c VPlacedVolume pointers. The arrays are also ready
+ * to be copied to a device as-is.
+ *
+ * Rows are grouped by mother: the daughters of the volume with ID \c i are
+ * rows <code>offsets[i]</code> up to <code>offsets[i + 1]</code>, in the
+ * same order as \c LogicalVolume::GetDaughters . Since placement IDs are
+ * assigned in the same order, each row number is the placement ID. Rotation
+ * components are in the element order of
+ * \c vecgeom::Transformation3D::Rotation . Bounding boxes are axis-aligned in
+ * the mother's frame.
+ */
+struct PlacementTable
+{
+    template<class T>
+    using Vec3 = std::array<std::vector<T>, 3>;
+
+    //! Row range for each mother volume ID (size is num LV + 1)
+    std::vector<unsigned int> offsets;
+
+    //!@{
+    //! \name Per-placement data
+    std::vector<unsigned int> mother;  //!< Mother volume ID
+    std::vector<unsigned int> volume;  //!< Daughter volume ID
+    std::vector<unsigned int> placed;  //!< Placement ID
+    std::vector<int> copy_number;
+    Vec3<double> translation;
+    std::array<std::vector<double>, 9> rotation;
+    Vec3<double> bbox_lower;
+    Vec3<double> bbox_upper;
+    //!@}
+
+    //! Number of placements
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(mother.size());
+    }
+
+    //! Whether there are no placements
+    bool empty() const { return mother.empty(); }
+};
+
+//---------------------------------------------------------------------------//
+// Build the placement table for all volumes reachable from the world
+PlacementTable build_placement_table(VolumeIds const& ids);
+
+// Refresh the transforms and bounding boxes of moved placements
+std::size_t update_placement_table(VolumeIds const& ids,
+                                   std::vector<bool> const& moved,
+                                   PlacementTable* table);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
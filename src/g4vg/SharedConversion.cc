@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/SharedConversion.cc
+//---------------------------------------------------------------------------//
+#include "SharedConversion.hh"
+
+#include <stdexcept>
+#include <G4Threading.hh>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert on the first call; later calls return the same result.
+ *
+ * The first call must come from the master thread (or a non-Geant4 thread):
+ * converting from a worker would mean the master never owned the geometry.
+ * Subsequent calls from any thread return the existing result, as long as
+ * they refer to the same world volume.
+ */
+auto SharedConversion::build(G4VPhysicalVolume const* world)
+    -> SPConstConverted
+{
+    if (!world)
+    {
+        throw std::invalid_argument("cannot convert a null world volume");
+    }
+
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    if (converted_)
+    {
+        if (world != world_)
+        {
+            throw std::logic_error(
+                "shared geometry was already converted from a different "
+                "world volume");
+        }
+        return converted_;
+    }
+
+    if (!G4Threading::IsMasterThread())
+    {
+        throw std::logic_error(
+            "shared geometry must be converted on the master thread before "
+            "workers start");
+    }
+
+    converted_ = std::make_shared<Converted const>(convert(world, options_));
+    world_ = world;
+    return converted_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the shared result, or null if not yet built.
+ */
+auto SharedConversion::get() const -> SPConstConverted
+{
+    std::lock_guard<std::mutex> scoped_lock{mutex_};
+    return converted_;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,80 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/SharedConversion.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include "G4VG.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a geometry once and share it with all Geant4 worker threads.
+ *
+ * Under \c G4MTRunManager or \c G4TaskRunManager, the detector geometry is
+ * constructed only on the master thread, but it is easy to end up calling
+ * \c g4vg::convert from every worker (multiplying startup time and memory,
+ * and racing on the VecGeom \c GeoManager singleton). This helper performs
+ * the conversion exactly once and hands every thread the same immutable
+ * result.
+ *
+ * Typical use is to keep an instance in the (shared) detector construction:
+ * \code
+   G4VPhysicalVolume* MyDetector::Construct()
+   {
+       auto* world = this->build_world();
+       converted_.build(world);  // Master thread only
+       return world;
+   }
+
+   void MyDetector::ConstructSDandField()
+   {
+       // Every worker shares the master's conversion
+       auto converted = converted_.get();
+       ...
+   }
+ * \endcode
+ *
+ * Thread-local lookup caches can be layered on top of the shared result; the
+ * result itself must not be modified after it is built.
+ */
+class SharedConversion
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstConverted = std::shared_ptr<Converted const>;
+    //!@}
+
+  public:
+    //! Construct with default conversion options
+    SharedConversion() = default;
+
+    //! Construct with custom conversion options
+    explicit SharedConversion(Options options) : options_{options} {}
+
+    // Convert on the first call; later calls return the same result
+    SPConstConverted build(G4VPhysicalVolume const* world);
+
+    // Get the shared result, or null if not yet built
+    SPConstConverted get() const;
+
+    //! Whether the geometry has been converted
+    explicit operator bool() const { return static_cast<bool>(this->get()); }
+
+  private:
+    Options options_;
+    mutable std::mutex mutex_;
+    G4VPhysicalVolume const* world_{nullptr};
+    SPConstConverted converted_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,754 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/SolidConverter.cc
+//---------------------------------------------------------------------------//
+#include "SolidConverter.hh"
+
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <G4BooleanSolid.hh>
+#include <G4Box.hh>
+#include <G4Cons.hh>
+#include <G4CutTubs.hh>
+#include <G4DisplacedSolid.hh>
+#include <G4Ellipsoid.hh>
+#include <G4EllipticalCone.hh>
+#include <G4EllipticalTube.hh>
+#include <G4ExtrudedSolid.hh>
+#include <G4GenericPolycone.hh>
+#include <G4GenericTrap.hh>
+#include <G4Hype.hh>
+#include <G4IntersectionSolid.hh>
+#include <G4MultiUnion.hh>
+#include <G4Orb.hh>
+#include <G4Para.hh>
+#include <G4Paraboloid.hh>
+#include <G4Polycone.hh>
+#include <G4Polyhedra.hh>
+#include <G4ReflectedSolid.hh>
+#include <G4ScaledSolid.hh>
+#include <G4Sphere.hh>
+#include <G4SubtractionSolid.hh>
+#include <G4TessellatedSolid.hh>
+#include <G4Tet.hh>
+#include <G4Torus.hh>
+#include <G4Trap.hh>
+#include <G4Trd.hh>
+#include <G4Tubs.hh>
+#include <G4UnionSolid.hh>
+#include <G4VFacet.hh>
+#include <VecGeom/management/GeoManager.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+#include <VecGeom/volumes/UnplacedBooleanVolume.h>
+#include <VecGeom/volumes/UnplacedBox.h>
+#include <VecGeom/volumes/UnplacedCone.h>
+#include <VecGeom/volumes/UnplacedCutTube.h>
+#include <VecGeom/volumes/UnplacedEllipsoid.h>
+#include <VecGeom/volumes/UnplacedEllipticalCone.h>
+#include <VecGeom/volumes/UnplacedEllipticalTube.h>
+#include <VecGeom/volumes/UnplacedExtruded.h>
+#include <VecGeom/volumes/UnplacedGenTrap.h>
+#include <VecGeom/volumes/UnplacedGenericPolycone.h>
+#include <VecGeom/volumes/UnplacedHype.h>
+#include <VecGeom/volumes/UnplacedMultiUnion.h>
+#include <VecGeom/volumes/UnplacedOrb.h>
+#include <VecGeom/volumes/UnplacedParaboloid.h>
+#include <VecGeom/volumes/UnplacedParallelepiped.h>
+#include <VecGeom/volumes/UnplacedPolycone.h>
+#include <VecGeom/volumes/UnplacedPolyhedron.h>
+#include <VecGeom/volumes/UnplacedScaledShape.h>
+#include <VecGeom/volumes/UnplacedSphere.h>
+#include <VecGeom/volumes/UnplacedTessellated.h>
+#include <VecGeom/volumes/UnplacedTet.h>
+#include <VecGeom/volumes/UnplacedTorus2.h>
+#include <VecGeom/volumes/UnplacedTrapezoid.h>
+#include <VecGeom/volumes/UnplacedTrd.h>
+#include <VecGeom/volumes/UnplacedTube.h>
+
+#include "UnplacedWrappedSolid.hh"
+#include "VolumeStore.hh"
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+using vecgeom::GeoManager;
+using Vec3 = vecgeom::Vector3D<vecgeom::Precision>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get polar and azimuthal angles of a trapezoid's symmetry axis.
+ */
+std::pair<double, double> sym_axis_angles(G4ThreeVector const& axis)
+{
+    double const theta = std::acos(axis.z());
+    double const phi = (axis.x() == 0 && axis.y() == 0)
+                           ? 0.0
+                           : std::atan2(axis.y(), axis.x());
+    return {theta, phi};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Strip displacements and reflections from a solid.
+ *
+ * The returned transform maps the innermost solid's frame to the frame of
+ * the original solid.
+ */
+UnwrappedSolid unwrap_solid(G4VSolid const& solid)
+{
+    UnwrappedSolid result{&solid, G4Transform3D{}};
+    while (true)
+    {
+        if (auto* disp = dynamic_cast<G4DisplacedSolid const*>(result.solid))
+        {
+            result.transform
+                = result.transform
+                  * G4Transform3D(disp->GetObjectRotation(),
+                                  disp->GetObjectTranslation());
+            result.solid = disp->GetConstituentMovedSolid();
+        }
+        else if (auto* refl
+                 = dynamic_cast<G4ReflectedSolid const*>(result.solid))
+        {
+            result.transform = result.transform
+                               * refl->GetDirectTransform3D();
+            result.solid = refl->GetConstituentMovedSolid();
+        }
+        else
+        {
+            return result;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Registered conversions.
+ */
+struct SolidConverter::Registry
+{
+    Registry();
+
+    std::mutex mutex;
+    std::vector<Entry> entries;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start with the built-in conversions.
+ *
+ * Solids with no exact match use the conversion for their most derived
+ * registered base: for example, a subclass of \c G4ExtrudedSolid is converted
+ * as an extruded solid rather than as its base \c G4TessellatedSolid . Among
+ * several conversions for the same type, the most recent one is used.
+ */
+SolidConverter::Registry::Registry()
+    : entries{
+        make_entry<G4BooleanSolid>(&SolidConverter::boolean),
+        make_entry<G4Box>(&SolidConverter::box),
+        make_entry<G4Cons>(&SolidConverter::cons),
+        make_entry<G4CutTubs>(&SolidConverter::cuttubs),
+        make_entry<G4Ellipsoid>(&SolidConverter::ellipsoid),
+        make_entry<G4EllipticalCone>(&SolidConverter::ellipticalcone),
+        make_entry<G4EllipticalTube>(&SolidConverter::ellipticaltube),
+        make_entry<G4ExtrudedSolid>(&SolidConverter::extrudedsolid),
+        make_entry<G4GenericPolycone>(&SolidConverter::genericpolycone),
+        make_entry<G4GenericTrap>(&SolidConverter::generictrap),
+        make_entry<G4Hype>(&SolidConverter::hype),
+        make_entry<G4MultiUnion>(&SolidConverter::multiunion),
+        make_entry<G4Orb>(&SolidConverter::orb),
+        make_entry<G4Para>(&SolidConverter::para),
+        make_entry<G4Paraboloid>(&SolidConverter::paraboloid),
+        make_entry<G4Polycone>(&SolidConverter::polycone),
+        make_entry<G4Polyhedra>(&SolidConverter::polyhedra),
+        make_entry<G4ScaledSolid>(&SolidConverter::scaledsolid),
+        make_entry<G4Sphere>(&SolidConverter::sphere),
+        make_entry<G4Tet>(&SolidConverter::tet),
+        make_entry<G4Torus>(&SolidConverter::torus),
+        make_entry<G4Trap>(&SolidConverter::trap),
+        make_entry<G4Trd>(&SolidConverter::trd),
+        make_entry<G4Tubs>(&SolidConverter::tubs),
+        make_entry<G4TessellatedSolid>(&SolidConverter::tessellatedsolid),
+    }
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get registered conversions.
+ */
+auto SolidConverter::registry() -> Registry&
+{
+    static Registry result;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a conversion to the registry.
+ */
+void SolidConverter::register_impl(Entry entry)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> scoped_lock{reg.mutex};
+    reg.entries.push_back(std::move(entry));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the length scale of the VecGeom geometry.
+ */
+SolidConverter::SolidConverter(double scale) : SolidConverter{scale, false}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct, optionally wrapping unsupported solids.
+ */
+SolidConverter::SolidConverter(double scale, bool wrap_unsupported)
+    : SolidConverter{scale, wrap_unsupported, nullptr}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct, giving ownership of created objects to a store.
+ *
+ * This takes a snapshot of the registered conversions and indexes them by
+ * exact type; later registrations take precedence. The store (if any) must
+ * outlive the converter.
+ */
+SolidConverter::SolidConverter(double scale,
+                               bool wrap_unsupported,
+                               VolumeStore* store)
+    : scale_{scale}
+    , wrap_unsupported_{wrap_unsupported}
+    , store_{store}
+    , transform_{scale}
+{
+    auto& reg = registry();
+    {
+        std::lock_guard<std::mutex> scoped_lock{reg.mutex};
+        entries_ = reg.entries;
+    }
+    for (std::size_t i = 0; i != entries_.size(); ++i)
+    {
+        dispatch_[entries_[i].type] = i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a solid, ignoring any displacement or reflection.
+ *
+ * The caller is responsible for applying the transform from
+ * \c unwrap_solid when placing the result.
+ */
+auto SolidConverter::operator()(G4VSolid const& solid)
+    -> VGUnplacedVolume const*
+{
+    G4VSolid const& inner = *unwrap_solid(solid).solid;
+    auto iter = cache_.find(&inner);
+    if (iter != cache_.end())
+    {
+        return iter->second;
+    }
+    auto const* result = this->convert_impl(inner);
+    cache_.insert({&inner, result});
+    if (store_)
+    {
+        store_->insert(result);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert an unwrapped solid.
+ */
+auto SolidConverter::convert_impl(G4VSolid const& solid)
+    -> VGUnplacedVolume const*
+{
+    std::type_index const type{typeid(solid)};
+    auto iter = dispatch_.find(type);
+    if (iter == dispatch_.end())
+    {
+        // Find the most derived registered base class (the most recent one
+        // if registered more than once), or remember that none exists
+        std::size_t index = entries_.size();
+        for (std::size_t i = entries_.size(); i != 0; --i)
+        {
+            auto const& entry = entries_[i - 1];
+            if (!entry.matches(solid))
+            {
+                continue;
+            }
+            if (index == entries_.size()
+                || (entry.type != entries_[index].type
+                    && entries_[index].is_base_of(entry.throw_null)))
+            {
+                index = i - 1;
+            }
+        }
+        iter = dispatch_.insert({type, index}).first;
+    }
+
+    if (iter->second == entries_.size())
+    {
+        if (wrap_unsupported_)
+        {
+            auto* result = GeoManager::MakeInstance<UnplacedWrappedSolid>(
+                &solid, scale_);
+            wrapped_.push_back(result);
+            return result;
+        }
+        throw std::runtime_error("unsupported Geant4 solid type '"
+                                 + std::string(solid.GetEntityType())
+                                 + "' for solid '" + solid.GetName() + "'");
+    }
+    return entries_[iter->second].convert(*this, solid);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Place a (possibly displaced) constituent in a helper volume.
+ */
+auto SolidConverter::place(G4VSolid const& solid) -> VGPlacedVolume const*
+{
+    return this->place(solid, G4Transform3D{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Place a constituent with an additional transform.
+ *
+ * The transform is applied after the constituent's own displacement.
+ */
+auto SolidConverter::place(G4VSolid const& solid,
+                           G4Transform3D const& transform)
+    -> VGPlacedVolume const*
+{
+    auto unwrapped = unwrap_solid(solid);
+    auto* lv = new vecgeom::LogicalVolume((*this)(*unwrapped.solid));
+    auto const xf = transform_(transform * unwrapped.transform);
+    auto* result = lv->Place(&xf);
+    if (store_)
+    {
+        store_->insert(lv);
+        store_->insert(result);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// SHAPE CONVERSIONS
+//---------------------------------------------------------------------------//
+auto SolidConverter::box(G4Box const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedBox>(
+        len(s.GetXHalfLength()),
+        len(s.GetYHalfLength()),
+        len(s.GetZHalfLength()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::boolean(G4BooleanSolid const& s)
+    -> VGUnplacedVolume const*
+{
+    auto const* left = this->place(*s.GetConstituentSolid(0));
+    auto const* right = this->place(*s.GetConstituentSolid(1));
+
+    if (dynamic_cast<G4UnionSolid const*>(&s))
+    {
+        return GeoManager::MakeInstance<
+            vecgeom::UnplacedBooleanVolume<vecgeom::kUnion>>(
+            vecgeom::kUnion, left, right);
+    }
+    if (dynamic_cast<G4SubtractionSolid const*>(&s))
+    {
+        return GeoManager::MakeInstance<
+            vecgeom::UnplacedBooleanVolume<vecgeom::kSubtraction>>(
+            vecgeom::kSubtraction, left, right);
+    }
+    if (dynamic_cast<G4IntersectionSolid const*>(&s))
+    {
+        return GeoManager::MakeInstance<
+            vecgeom::UnplacedBooleanVolume<vecgeom::kIntersection>>(
+            vecgeom::kIntersection, left, right);
+    }
+    throw std::runtime_error("unsupported boolean operation for solid '"
+                             + s.GetName() + "'");
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::cons(G4Cons const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedCone>(
+        len(s.GetInnerRadiusMinusZ()),
+        len(s.GetOuterRadiusMinusZ()),
+        len(s.GetInnerRadiusPlusZ()),
+        len(s.GetOuterRadiusPlusZ()),
+        len(s.GetZHalfLength()),
+        s.GetStartPhiAngle(),
+        s.GetDeltaPhiAngle());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::cuttubs(G4CutTubs const& s) -> VGUnplacedVolume const*
+{
+    auto const lo = s.GetLowNorm();
+    auto const hi = s.GetHighNorm();
+    return GeoManager::MakeInstance<vecgeom::UnplacedCutTube>(
+        len(s.GetInnerRadius()),
+        len(s.GetOuterRadius()),
+        len(s.GetZHalfLength()),
+        s.GetStartPhiAngle(),
+        s.GetDeltaPhiAngle(),
+        Vec3(lo.x(), lo.y(), lo.z()),
+        Vec3(hi.x(), hi.y(), hi.z()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::ellipsoid(G4Ellipsoid const& s)
+    -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedEllipsoid>(
+        len(s.GetDx()),
+        len(s.GetDy()),
+        len(s.GetDz()),
+        len(s.GetZBottomCut()),
+        len(s.GetZTopCut()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::ellipticalcone(G4EllipticalCone const& s)
+    -> VGUnplacedVolume const*
+{
+    // Semi-axes are dimensionless slopes
+    return GeoManager::MakeInstance<vecgeom::UnplacedEllipticalCone>(
+        s.GetSemiAxisX(),
+        s.GetSemiAxisY(),
+        len(s.GetZMax()),
+        len(s.GetZTopCut()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::ellipticaltube(G4EllipticalTube const& s)
+    -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedEllipticalTube>(
+        len(s.GetDx()), len(s.GetDy()), len(s.GetDz()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::extrudedsolid(G4ExtrudedSolid const& s)
+    -> VGUnplacedVolume const*
+{
+    std::vector<vecgeom::XtruVertex2> vertices(s.GetNofVertices());
+    for (std::size_t i = 0; i != vertices.size(); ++i)
+    {
+        auto const v = s.GetVertex(i);
+        vertices[i].x = len(v.x());
+        vertices[i].y = len(v.y());
+    }
+
+    std::vector<vecgeom::XtruSection> sections(s.GetNofZSections());
+    for (std::size_t i = 0; i != sections.size(); ++i)
+    {
+        auto const z = s.GetZSection(i);
+        sections[i].fOrigin
+            = Vec3(len(z.fOffset.x()), len(z.fOffset.y()), len(z.fZ));
+        sections[i].fScale = z.fScale;
+    }
+
+    return GeoManager::MakeInstance<vecgeom::UnplacedExtruded>(
+        static_cast<int>(vertices.size()),
+        vertices.data(),
+        static_cast<int>(sections.size()),
+        sections.data());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::genericpolycone(G4GenericPolycone const& s)
+    -> VGUnplacedVolume const*
+{
+    std::vector<double> r(s.GetNumRZCorner());
+    std::vector<double> z(r.size());
+    for (std::size_t i = 0; i != r.size(); ++i)
+    {
+        auto const corner = s.GetCorner(i);
+        r[i] = len(corner.r);
+        z[i] = len(corner.z);
+    }
+
+    return GeoManager::MakeInstance<vecgeom::UnplacedGenericPolycone>(
+        s.GetStartPhi(),
+        s.GetEndPhi() - s.GetStartPhi(),
+        static_cast<int>(r.size()),
+        r.data(),
+        z.data());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::generictrap(G4GenericTrap const& s)
+    -> VGUnplacedVolume const*
+{
+    auto const& vertices = s.GetVertices();
+    std::vector<double> x(vertices.size());
+    std::vector<double> y(vertices.size());
+    for (std::size_t i = 0; i != vertices.size(); ++i)
+    {
+        x[i] = len(vertices[i].x());
+        y[i] = len(vertices[i].y());
+    }
+
+    return GeoManager::MakeInstance<vecgeom::UnplacedGenTrap>(
+        x.data(), y.data(), len(s.GetZHalfLength()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::hype(G4Hype const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedHype>(
+        len(s.GetInnerRadius()),
+        len(s.GetOuterRadius()),
+        s.GetInnerStereo(),
+        s.GetOuterStereo(),
+        len(s.GetZHalfLength()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::multiunion(G4MultiUnion const& s)
+    -> VGUnplacedVolume const*
+{
+    auto* result = GeoManager::MakeInstance<vecgeom::UnplacedMultiUnion>();
+    for (int i = 0; i != s.GetNumberOfSolids(); ++i)
+    {
+        // Place nodes here so that the store owns their helper volumes
+        result->AddNode(this->place(*s.GetSolid(i), s.GetTransformation(i)));
+    }
+    result->Close();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::orb(G4Orb const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedOrb>(
+        len(s.GetRadius()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::para(G4Para const& s) -> VGUnplacedVolume const*
+{
+    auto const [theta, phi] = sym_axis_angles(s.GetSymAxis());
+    return GeoManager::MakeInstance<vecgeom::UnplacedParallelepiped>(
+        len(s.GetXHalfLength()),
+        len(s.GetYHalfLength()),
+        len(s.GetZHalfLength()),
+        std::atan(s.GetTanAlpha()),
+        theta,
+        phi);
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::paraboloid(G4Paraboloid const& s)
+    -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedParaboloid>(
+        len(s.GetRadiusMinusZ()),
+        len(s.GetRadiusPlusZ()),
+        len(s.GetZHalfLength()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::polycone(G4Polycone const& s) -> VGUnplacedVolume const*
+{
+    auto const* params = s.GetOriginalParameters();
+    auto const num_z = params->Num_z_planes;
+    std::vector<double> z(num_z);
+    std::vector<double> rmin(num_z);
+    std::vector<double> rmax(num_z);
+    for (int i = 0; i != num_z; ++i)
+    {
+        z[i] = len(params->Z_values[i]);
+        rmin[i] = len(params->Rmin[i]);
+        rmax[i] = len(params->Rmax[i]);
+    }
+
+    return GeoManager::MakeInstance<vecgeom::UnplacedPolycone>(
+        params->Start_angle,
+        params->Opening_angle,
+        num_z,
+        z.data(),
+        rmin.data(),
+        rmax.data());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::polyhedra(G4Polyhedra const& s)
+    -> VGUnplacedVolume const*
+{
+    auto const* params = s.GetOriginalParameters();
+    auto const num_z = params->Num_z_planes;
+
+    // Geant4 stores radii of the circumscribing circle; VecGeom wants the
+    // distance to the flat sides
+    double const radius_factor
+        = std::cos(0.5 * params->Opening_angle / params->numSide);
+
+    std::vector<double> z(num_z);
+    std::vector<double> rmin(num_z);
+    std::vector<double> rmax(num_z);
+    for (int i = 0; i != num_z; ++i)
+    {
+        z[i] = len(params->Z_values[i]);
+        rmin[i] = len(params->Rmin[i] * radius_factor);
+        rmax[i] = len(params->Rmax[i] * radius_factor);
+    }
+
+    return GeoManager::MakeInstance<vecgeom::UnplacedPolyhedron>(
+        params->Start_angle,
+        params->Opening_angle,
+        params->numSide,
+        num_z,
+        z.data(),
+        rmin.data(),
+        rmax.data());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::scaledsolid(G4ScaledSolid const& s)
+    -> VGUnplacedVolume const*
+{
+    auto const* placed = this->place(*s.GetUnscaledSolid());
+    auto const scale = s.GetScaleTransform();
+    return GeoManager::MakeInstance<vecgeom::UnplacedScaledShape>(
+        placed, scale.xx(), scale.yy(), scale.zz());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::sphere(G4Sphere const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedSphere>(
+        len(s.GetInnerRadius()),
+        len(s.GetOuterRadius()),
+        s.GetStartPhiAngle(),
+        s.GetDeltaPhiAngle(),
+        s.GetStartThetaAngle(),
+        s.GetDeltaThetaAngle());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::tessellatedsolid(G4TessellatedSolid const& s)
+    -> VGUnplacedVolume const*
+{
+    auto* result = GeoManager::MakeInstance<vecgeom::UnplacedTessellated>();
+    auto vertex = [this](G4VFacet const& facet, int i) {
+        auto const v = facet.GetVertex(i);
+        return Vec3(len(v.x()), len(v.y()), len(v.z()));
+    };
+
+    for (int i = 0; i != s.GetNumberOfFacets(); ++i)
+    {
+        auto const& facet = *s.GetFacet(i);
+        if (facet.GetNumberOfVertices() == 3)
+        {
+            result->AddTriangularFacet(vertex(facet, 0),
+                                       vertex(facet, 1),
+                                       vertex(facet, 2),
+                                       /* absolute = */ true);
+        }
+        else
+        {
+            result->AddQuadrilateralFacet(vertex(facet, 0),
+                                          vertex(facet, 1),
+                                          vertex(facet, 2),
+                                          vertex(facet, 3),
+                                          /* absolute = */ true);
+        }
+    }
+    result->Close();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::tet(G4Tet const& s) -> VGUnplacedVolume const*
+{
+    auto const vertices = s.GetVertices();
+    std::vector<Vec3> points;
+    for (auto const& v : vertices)
+    {
+        points.emplace_back(len(v.x()), len(v.y()), len(v.z()));
+    }
+    return GeoManager::MakeInstance<vecgeom::UnplacedTet>(
+        points[0], points[1], points[2], points[3]);
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::torus(G4Torus const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedTorus2>(
+        len(s.GetRmin()),
+        len(s.GetRmax()),
+        len(s.GetRtor()),
+        s.GetSPhi(),
+        s.GetDPhi());
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::trap(G4Trap const& s) -> VGUnplacedVolume const*
+{
+    auto const [theta, phi] = sym_axis_angles(s.GetSymAxis());
+    return GeoManager::MakeInstance<vecgeom::UnplacedTrapezoid>(
+        len(s.GetZHalfLength()),
+        theta,
+        phi,
+        len(s.GetYHalfLength1()),
+        len(s.GetXHalfLength1()),
+        len(s.GetXHalfLength2()),
+        std::atan(s.GetTanAlpha1()),
+        len(s.GetYHalfLength2()),
+        len(s.GetXHalfLength3()),
+        len(s.GetXHalfLength4()),
+        std::atan(s.GetTanAlpha2()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::trd(G4Trd const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedTrd>(
+        len(s.GetXHalfLength1()),
+        len(s.GetXHalfLength2()),
+        len(s.GetYHalfLength1()),
+        len(s.GetYHalfLength2()),
+        len(s.GetZHalfLength()));
+}
+
+//---------------------------------------------------------------------------//
+auto SolidConverter::tubs(G4Tubs const& s) -> VGUnplacedVolume const*
+{
+    return GeoManager::MakeInstance<vecgeom::UnplacedTube>(
+        len(s.GetInnerRadius()),
+        len(s.GetOuterRadius()),
+        len(s.GetZHalfLength()),
+        s.GetStartPhiAngle(),
+        s.GetDeltaPhiAngle());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,268 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/SolidConverter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <typeindex>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <G4Transform3D.hh>
+#include <G4VSolid.hh>
+
+#include "Transformer.hh"
+
+class G4BooleanSolid;
+class G4Box;
+class G4Cons;
+class G4CutTubs;
+class G4Ellipsoid;
+class G4EllipticalCone;
+class G4EllipticalTube;
+class G4ExtrudedSolid;
+class G4GenericPolycone;
+class G4GenericTrap;
+class G4Hype;
+class G4MultiUnion;
+class G4Orb;
+class G4Para;
+class G4Paraboloid;
+class G4Polycone;
+class G4Polyhedra;
+class G4ScaledSolid;
+class G4Sphere;
+class G4TessellatedSolid;
+class G4Tet;
+class G4Torus;
+class G4Trap;
+class G4Trd;
+class G4Tubs;
+
+namespace vecgeom
+{
+inline namespace cxx
+{
+class VPlacedVolume;
+class VUnplacedVolume;
+}  // namespace cxx
+}  // namespace vecgeom
+
+namespace g4vg
+{
+class UnplacedWrappedSolid;
+class VolumeStore;
+
+//---------------------------------------------------------------------------//
+/*!
+ * A solid stripped of its displacement and reflection wrappers.
+ *
+ * VecGeom has no displaced or reflected shapes: these are folded into the
+ * transform of whatever places the solid.
+ */
+struct UnwrappedSolid
+{
+    G4VSolid const* solid{nullptr};
+    G4Transform3D transform;
+};
+
+// Strip displacements and reflections from a solid
+UnwrappedSolid unwrap_solid(G4VSolid const& solid);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert Geant4 solids to VecGeom shapes.
+ *
+ * Each unwrapped solid is converted once. Constituents of boolean, scaled,
+ * and multi-union solids are placed in unnamed helper logical volumes, which
+ * are created (and take VecGeom IDs) immediately before the volume using the
+ * shape.
+ *
+ * Conversions are looked up in a table indexed by the solid's dynamic type.
+ * A solid whose exact type is not registered uses the most recently
+ * registered base class, found once per type and then remembered, so client
+ * conversions for subclasses of built-in types take precedence. Client code
+ * can register conversions for its own solid types (or replace the built-in
+ * ones) with \c register_type before constructing the converter. Solids with
+ * no registered conversion are an error unless wrapping is enabled, in which
+ * case they are wrapped in a \c UnplacedWrappedSolid that calls Geant4.
+ *
+ * If a \c VolumeStore is given, every shape and helper volume created by the
+ * converter is added to it.
+ *
+ * Example registration:
+ * \code
+   SolidConverter::register_type<MySolid>(
+       [](SolidConverter& convert, MySolid const& solid) {
+           return vecgeom::GeoManager::MakeInstance<vecgeom::UnplacedOrb>(
+               convert.scale() * solid.GetRadius());
+       });
+ * \endcode
+ */
+class SolidConverter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VGPlacedVolume = vecgeom::VPlacedVolume;
+    using VGUnplacedVolume = vecgeom::VUnplacedVolume;
+    using VecWrapped = std::vector<UnplacedWrappedSolid const*>;
+    using ConvertFunction
+        = std::function<VGUnplacedVolume const*(SolidConverter&,
+                                                G4VSolid const&)>;
+    //!@}
+
+  public:
+    // Register a conversion for a solid type and its subclasses
+    template<class T, class F>
+    static void register_type(F&& convert);
+
+    // Construct with the length scale of the VecGeom geometry
+    explicit SolidConverter(double scale);
+
+    // Construct, optionally wrapping unsupported solids
+    SolidConverter(double scale, bool wrap_unsupported);
+
+    // Construct, giving ownership of created objects to a store
+    SolidConverter(double scale, bool wrap_unsupported, VolumeStore* store);
+
+    // Convert a solid, ignoring any displacement or reflection
+    VGUnplacedVolume const* operator()(G4VSolid const& solid);
+
+    // Place a (possibly displaced) constituent in a helper volume
+    VGPlacedVolume const* place(G4VSolid const& solid);
+
+    // Place a constituent with an additional transform
+    VGPlacedVolume const*
+    place(G4VSolid const& solid, G4Transform3D const& transform);
+
+    //! Length scale of the VecGeom geometry
+    double scale() const { return scale_; }
+
+    //! Shapes created for unsupported solids
+    VecWrapped const& wrapped() const { return wrapped_; }
+
+  private:
+    struct Entry
+    {
+        std::type_index type;
+        ConvertFunction convert;
+        bool (*matches)(G4VSolid const&);
+        void (*throw_null)();
+        bool (*is_base_of)(void (*throw_null)());
+    };
+    struct Registry;
+
+    double scale_;
+    bool wrap_unsupported_;
+    VolumeStore* store_;
+    Transformer transform_;
+    std::vector<Entry> entries_;
+    std::unordered_map<std::type_index, std::size_t> dispatch_;
+    std::unordered_map<G4VSolid const*, VGUnplacedVolume const*> cache_;
+    VecWrapped wrapped_;
+
+    // Registered conversions, starting with the built-in ones
+    static Registry& registry();
+    static void register_impl(Entry entry);
+    template<class T, class F>
+    static Entry make_entry(F&& convert);
+
+    // Convert an unwrapped solid
+    VGUnplacedVolume const* convert_impl(G4VSolid const& solid);
+
+    //! Scale a length
+    double len(double value) const { return scale_ * value; }
+
+    //!@{
+    //! \name Shape conversions
+    VGUnplacedVolume const* box(G4Box const&);
+    VGUnplacedVolume const* boolean(G4BooleanSolid const&);
+    VGUnplacedVolume const* cons(G4Cons const&);
+    VGUnplacedVolume const* cuttubs(G4CutTubs const&);
+    VGUnplacedVolume const* ellipsoid(G4Ellipsoid const&);
+    VGUnplacedVolume const* ellipticalcone(G4EllipticalCone const&);
+    VGUnplacedVolume const* ellipticaltube(G4EllipticalTube const&);
+    VGUnplacedVolume const* extrudedsolid(G4ExtrudedSolid const&);
+    VGUnplacedVolume const* genericpolycone(G4GenericPolycone const&);
+    VGUnplacedVolume const* generictrap(G4GenericTrap const&);
+    VGUnplacedVolume const* hype(G4Hype const&);
+    VGUnplacedVolume const* multiunion(G4MultiUnion const&);
+    VGUnplacedVolume const* orb(G4Orb const&);
+    VGUnplacedVolume const* para(G4Para const&);
+    VGUnplacedVolume const* paraboloid(G4Paraboloid const&);
+    VGUnplacedVolume const* polycone(G4Polycone const&);
+    VGUnplacedVolume const* polyhedra(G4Polyhedra const&);
+    VGUnplacedVolume const* scaledsolid(G4ScaledSolid const&);
+    VGUnplacedVolume const* sphere(G4Sphere const&);
+    VGUnplacedVolume const* tessellatedsolid(G4TessellatedSolid const&);
+    VGUnplacedVolume const* tet(G4Tet const&);
+    VGUnplacedVolume const* torus(G4Torus const&);
+    VGUnplacedVolume const* trap(G4Trap const&);
+    VGUnplacedVolume const* trd(G4Trd const&);
+    VGUnplacedVolume const* tubs(G4Tubs const&);
+    //!@}
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Register a conversion for a solid type and its subclasses.
+ *
+ * The function is called as \c convert(SolidConverter&, T const&) and must
+ * return a new shape created with \c vecgeom::GeoManager::MakeInstance,
+ * which is then owned by the converter's store (if any). A later
+ * registration for the same type replaces the earlier one. Converters that
+ * are already constructed are unaffected.
+ */
+template<class T, class F>
+void SolidConverter::register_type(F&& convert)
+{
+    static_assert(std::is_base_of_v<G4VSolid, T>,
+                  "registered types must be Geant4 solids");
+    register_impl(make_entry<T>(std::forward<F>(convert)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wrap a conversion so that it can be called with any solid of type T.
+ */
+template<class T, class F>
+auto SolidConverter::make_entry(F&& convert) -> Entry
+{
+    return {typeid(T),
+            [convert = std::forward<F>(convert)](SolidConverter& sc,
+                                                 G4VSolid const& solid) {
+                return std::invoke(
+                    convert, sc, static_cast<T const&>(solid));
+            },
+            [](G4VSolid const& solid) {
+                return dynamic_cast<T const*>(&solid) != nullptr;
+            },
+            [] { throw static_cast<T const*>(nullptr); },
+            [](void (*throw_null)()) {
+                // A handler for a base pointer catches a derived pointer
+                try
+                {
+                    throw_null();
+                }
+                catch (T const*)
+                {
+                    return true;
+                }
+                catch (...)
+                {
+                }
+                return false;
+            }};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
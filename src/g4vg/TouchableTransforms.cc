@@ -0,0 +1,221 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/TouchableTransforms.cc
+//---------------------------------------------------------------------------//
+#include "TouchableTransforms.hh"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <VecGeom/base/Transformation3D.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "LinearTree.hh"
+#include "VolumeIds.hh"
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+std::size_t count_rows(LinearTree const& tree,
+                       std::vector<bool> const& selected)
+{
+    std::size_t result = 0;
+    for (unsigned int vol : tree.volume)
+    {
+        if (vol < selected.size() && selected[vol])
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Compose the global transform of a tree node from the world down
+void compose_global(VolumeIds const& ids,
+                    LinearTree const& tree,
+                    unsigned int node,
+                    std::vector<unsigned int>* path,
+                    double* t)
+{
+    path->clear();
+    for (unsigned int n = node; n != LinearTree::no_parent; n = tree.parent[n])
+    {
+        path->push_back(n);
+    }
+
+    vecgeom::Transformation3D global;
+    for (auto iter = path->rbegin(); iter != path->rend(); ++iter)
+    {
+        auto const* pv = ids.placement(tree.placed[*iter]);
+        global.MultiplyFromRight(*pv->GetTransformation());
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        t[i] = global.Translation(i);
+    }
+    for (int i = 0; i < 9; ++i)
+    {
+        t[3 + i] = global.Rotation(i);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Estimate the memory needed for a table with this many rows.
+ *
+ * The number of rows can be counted from the Geant4 tree with
+ * \c count_touchables before anything is built. It is a floating point
+ * value because the number of paths through a deep geometry may overflow an
+ * integer; the result saturates at the largest size.
+ */
+std::size_t estimate_touchable_bytes(double num_rows)
+{
+    constexpr auto max_bytes = std::numeric_limits<std::size_t>::max();
+    double const bytes
+        = num_rows
+          * (sizeof(unsigned int)
+             + TouchableTransforms::stride * sizeof(double));
+    return bytes < static_cast<double>(max_bytes)
+               ? static_cast<std::size_t>(bytes)
+               : max_bytes;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute global transforms for the touchables of the selected volumes.
+ *
+ * The selection is indexed by volume ID. The caller should check
+ * \c estimate_touchable_bytes first, since the table is always allocated.
+ * Rows are split evenly between up to \c num_threads threads (all hardware
+ * threads if zero); each row is composed independently from the world down,
+ * so the result does not depend on the number of threads.
+ */
+TouchableTransforms
+build_touchable_transforms(VolumeIds const& ids,
+                           LinearTree const& tree,
+                           std::vector<bool> const& selected,
+                           unsigned int num_threads)
+{
+    TouchableTransforms result;
+    std::size_t const num_rows = count_rows(tree, selected);
+    result.estimated_bytes
+        = estimate_touchable_bytes(static_cast<double>(num_rows));
+
+    // Assign rows in tree order
+    result.node.reserve(num_rows);
+    for (unsigned int n = 0; n != tree.size(); ++n)
+    {
+        unsigned int vol = tree.volume[n];
+        if (vol < selected.size() && selected[vol])
+        {
+            result.node.push_back(n);
+        }
+    }
+    if (result.empty())
+    {
+        return result;
+    }
+    result.transform.resize(TouchableTransforms::stride * num_rows);
+
+    auto fill_rows = [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned int> path;
+        for (std::size_t r = begin; r != end; ++r)
+        {
+            compose_global(ids,
+                           tree,
+                           result.node[r],
+                           &path,
+                           result.transform.data()
+                               + TouchableTransforms::stride * r);
+        }
+    };
+
+    if (num_threads == 0)
+    {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::size_t const num_chunks
+        = std::min<std::size_t>(num_threads, num_rows);
+    if (num_chunks <= 1)
+    {
+        fill_rows(0, num_rows);
+        return result;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_chunks);
+    for (std::size_t i = 0; i != num_chunks; ++i)
+    {
+        threads.emplace_back(fill_rows,
+                             i * num_rows / num_chunks,
+                             (i + 1) * num_rows / num_chunks);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Recompute the touchables below moved placements.
+ *
+ * The selection is indexed by placement ID. Every row whose path
+ * from the world passes through a moved placement is recomposed; this
+ * returns the number of rows updated.
+ */
+std::size_t update_touchable_transforms(VolumeIds const& ids,
+                                        LinearTree const& tree,
+                                        std::vector<bool> const& moved,
+                                        TouchableTransforms* touchables)
+{
+    if (touchables->empty())
+    {
+        return 0;
+    }
+
+    std::vector<unsigned int> path;
+    std::size_t result = 0;
+    unsigned int moved_end = 0;
+    unsigned int r = 0;
+    for (unsigned int n = 0; n != tree.size() && r != touchables->size();
+         ++n)
+    {
+        unsigned int const pv = tree.placed[n];
+        if (pv < moved.size() && moved[pv])
+        {
+            // The whole subtree moves with this node
+            moved_end = std::max(moved_end, tree.skip[n]);
+        }
+        if (touchables->node[r] != n)
+        {
+            continue;
+        }
+        if (n < moved_end)
+        {
+            compose_global(ids,
+                           tree,
+                           n,
+                           &path,
+                           touchables->transform.data()
+                               + TouchableTransforms::stride * r);
+            ++result;
+        }
+        ++r;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
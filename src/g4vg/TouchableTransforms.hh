@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/TouchableTransforms.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace g4vg
+{
+struct LinearTree;
+class VolumeIds;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Precomputed global-to-local transforms for the touchables of some volumes.
+ *
+ * Each row is one touchable (one node of the \c LinearTree ) whose logical
+ * volume was selected at conversion. Transforming a global point into the
+ * local frame of a selected touchable is then a single matrix multiply
+ * instead of a walk down the placement hierarchy:
+ * \code
+   auto row = converted.touchables.row(node);
+   auto local = converted.touchables.to_local(row, global);
+ * \endcode
+ *
+ * Rows are in tree order, so the row of a node is found by a binary search
+ * of the selected nodes rather than a table over the whole tree.
+ *
+ * Each transform is stored as 12 doubles: the translation followed by the
+ * rotation, in the convention of \c vecgeom::Transformation3D .
+ */
+struct TouchableTransforms
+{
+    //!@{
+    //! \name Type aliases
+    using Real3 = std::array<double, 3>;
+    //!@}
+
+    //! Row of a tree node that was not selected
+    static constexpr unsigned int no_row = static_cast<unsigned int>(-1);
+
+    //! Number of doubles per transform
+    static constexpr unsigned int stride = 12;
+
+    //! Tree node for each row, in increasing order
+    std::vector<unsigned int> node;
+
+    //! Global-to-local transform for each row
+    std::vector<double> transform;
+
+    //! Heap memory needed for the table, computed before it is allocated
+    std::size_t estimated_bytes{0};
+
+    //! Number of rows
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(node.size());
+    }
+
+    //! Whether the table is empty
+    bool empty() const { return node.empty(); }
+
+    // Row of a tree node, or no_row
+    inline unsigned int row(unsigned int n) const;
+
+    // Transform a global point to the local frame of a touchable
+    inline Real3 to_local(unsigned int r, Real3 const& pos) const;
+};
+
+//---------------------------------------------------------------------------//
+// Estimate the memory needed for a table with this many rows
+std::size_t estimate_touchable_bytes(double num_rows);
+
+// Compute global transforms for the touchables of the selected volumes
+TouchableTransforms
+build_touchable_transforms(VolumeIds const& ids,
+                           LinearTree const& tree,
+                           std::vector<bool> const& selected,
+                           unsigned int num_threads);
+
+// Recompute the touchables below moved placements
+std::size_t update_touchable_transforms(VolumeIds const& ids,
+                                        LinearTree const& tree,
+                                        std::vector<bool> const& moved,
+                                        TouchableTransforms* touchables);
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Row of a tree node, or \c no_row if its volume was not selected.
+ */
+unsigned int TouchableTransforms::row(unsigned int n) const
+{
+    auto iter = std::lower_bound(node.begin(), node.end(), n);
+    return iter != node.end() && *iter == n
+               ? static_cast<unsigned int>(iter - node.begin())
+               : no_row;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transform a global point to the local frame of a touchable.
+ *
+ * This is equivalent to \c vecgeom::Transformation3D::Transform with the
+ * touchable's global matrix.
+ */
+auto TouchableTransforms::to_local(unsigned int r, Real3 const& pos) const
+    -> Real3
+{
+    double const* t = transform.data() + stride * r;
+    double const* rot = t + 3;
+    Real3 const p{pos[0] - t[0], pos[1] - t[1], pos[2] - t[2]};
+    return {rot[0] * p[0] + rot[3] * p[1] + rot[6] * p[2],
+            rot[1] * p[0] + rot[4] * p[1] + rot[7] * p[2],
+            rot[2] * p[0] + rot[5] * p[1] + rot[8] * p[2]};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,48 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Transformer.cc
+//---------------------------------------------------------------------------//
+#include "Transformer.hh"
+
+#include <G4VPhysicalVolume.hh>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert an object transform.
+ */
+vecgeom::Transformation3D Transformer::operator()(G4Transform3D const& t) const
+{
+    return {scale_ * t.dx(),
+            scale_ * t.dy(),
+            scale_ * t.dz(),
+            t.xx(),
+            t.yx(),
+            t.zx(),
+            t.xy(),
+            t.yy(),
+            t.zy(),
+            t.xz(),
+            t.yz(),
+            t.zz()};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the object transform of a physical volume.
+ *
+ * For replicated and parameterised volumes, this is the transform of the
+ * most recently computed copy.
+ */
+G4Transform3D object_transform(G4VPhysicalVolume const& pv)
+{
+    return G4Transform3D(pv.GetObjectRotationValue(),
+                         pv.GetObjectTranslation());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
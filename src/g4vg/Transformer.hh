@@ -0,0 +1,43 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Transformer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <G4Transform3D.hh>
+#include <VecGeom/base/Transformation3D.h>
+
+class G4VPhysicalVolume;
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert Geant4 transforms to VecGeom transforms.
+ *
+ * Geant4 object transforms map local to mother coordinates, \f$ M x + t \f$.
+ * VecGeom stores the same transform with the rotation transposed, and
+ * supports reflections (a negative determinant) directly.
+ */
+class Transformer
+{
+  public:
+    //! Construct with the length scale of the VecGeom geometry
+    explicit Transformer(double scale) : scale_{scale} {}
+
+    // Convert an object transform
+    vecgeom::Transformation3D operator()(G4Transform3D const& t) const;
+
+  private:
+    double scale_;
+};
+
+//---------------------------------------------------------------------------//
+// Get the object transform of a physical volume
+G4Transform3D object_transform(G4VPhysicalVolume const& pv);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,621 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/UnplacedWrappedSolid.cc
+//---------------------------------------------------------------------------//
+#include "UnplacedWrappedSolid.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <G4VSolid.hh>
+#include <VecGeom/base/SOA3D.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Convert a VecGeom vector to Geant4
+G4ThreeVector to_g4(vecgeom::Vector3D<vecgeom::Precision> const& v,
+                    double inv_scale)
+{
+    return {v.x() * inv_scale, v.y() * inv_scale, v.z() * inv_scale};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Scale a Geant4 distance or safety using the VecGeom sign convention.
+ *
+ * Geant4 returns zero for a point on the wrong side of the solid, which
+ * VecGeom can't distinguish from a point on the surface: VecGeom returns -1
+ * instead. The solid is only queried if the distance is zero.
+ */
+double from_g4(double dist,
+               double scale,
+               G4VSolid const& solid,
+               G4ThreeVector const& pos,
+               EInside wrong_side)
+{
+    if (dist == 0 && solid.Inside(pos) == wrong_side)
+    {
+        return -1;
+    }
+    return scale * dist;
+}
+
+//---------------------------------------------------------------------------//
+//! Extract one lane of a SIMD vector
+vecgeom::Vector3D<vecgeom::Precision>
+get_lane(UnplacedWrappedSolid::Real3_v const& v, std::size_t i)
+{
+    return {vecCore::Get(v.x(), i), vecCore::Get(v.y(), i),
+            vecCore::Get(v.z(), i)};
+}
+
+//---------------------------------------------------------------------------//
+//! Evaluate a scalar function of the lane index for every SIMD lane
+template<class F>
+UnplacedWrappedSolid::Real_v map_lanes(F&& eval)
+{
+    using Real_v = UnplacedWrappedSolid::Real_v;
+    Real_v result;
+    for (std::size_t i = 0; i != vecCore::VectorSize<Real_v>(); ++i)
+    {
+        vecCore::Set(result, i, eval(i));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Placement of a wrapped Geant4 solid.
+ *
+ * Points and directions are transformed to the local frame and passed to the
+ * unplaced shape. The SIMD and container interfaces loop over the scalar
+ * calls, since the Geant4 solid has no vectorized implementation.
+ */
+class PlacedWrappedSolid final : public vecgeom::VPlacedVolume
+{
+  public:
+    using Precision = vecgeom::Precision;
+    using Real3 = vecgeom::Vector3D<Precision>;
+    using Real_v = UnplacedWrappedSolid::Real_v;
+    using Real3_v = UnplacedWrappedSolid::Real3_v;
+    using SOA3D = UnplacedWrappedSolid::SOA3D;
+
+    PlacedWrappedSolid(vecgeom::LogicalVolume const* volume,
+                       vecgeom::Transformation3D const* transformation)
+        : vecgeom::VPlacedVolume{"", volume, transformation}
+    {
+    }
+
+    void PrintType() const final { this->PrintType(std::cout); }
+    void PrintType(std::ostream& os) const final
+    {
+        os << "PlacedWrappedSolid";
+    }
+    void PrintImplementationType(std::ostream& os) const final
+    {
+        this->PrintType(os);
+    }
+    void PrintUnplacedType(std::ostream& os) const final
+    {
+        os << "UnplacedWrappedSolid";
+    }
+    int MemorySize() const final { return sizeof(*this); }
+
+    bool Contains(Real3 const& pos) const final
+    {
+        return this->unplaced().Contains(this->to_local(pos));
+    }
+    bool Contains(Real3 const& pos, Real3& local) const final
+    {
+        local = this->to_local(pos);
+        return this->unplaced().Contains(local);
+    }
+    bool UnplacedContains(Real3 const& local) const final
+    {
+        return this->unplaced().Contains(local);
+    }
+    vecgeom::EnumInside Inside(Real3 const& pos) const final
+    {
+        return this->unplaced().Inside(this->to_local(pos));
+    }
+    Precision DistanceToIn(Real3 const& pos,
+                           Real3 const& dir,
+                           Precision step_max) const final
+    {
+        auto const* t = this->GetTransformation();
+        return this->unplaced().DistanceToIn(
+            t->Transform(pos), t->TransformDirection(dir), step_max);
+    }
+    Precision DistanceToOut(Real3 const& local_pos,
+                            Real3 const& local_dir,
+                            Precision step_max) const final
+    {
+        return this->unplaced().DistanceToOut(local_pos, local_dir, step_max);
+    }
+    Precision PlacedDistanceToOut(Real3 const& pos,
+                                  Real3 const& dir,
+                                  Precision step_max) const final
+    {
+        auto const* t = this->GetTransformation();
+        return this->unplaced().DistanceToOut(
+            t->Transform(pos), t->TransformDirection(dir), step_max);
+    }
+    Precision SafetyToIn(Real3 const& pos) const final
+    {
+        return this->unplaced().SafetyToIn(this->to_local(pos));
+    }
+    Precision SafetyToOut(Real3 const& local_pos) const final
+    {
+        return this->unplaced().SafetyToOut(local_pos);
+    }
+    bool Normal(Real3 const& pos, Real3& normal) const final
+    {
+        auto const* t = this->GetTransformation();
+        Real3 local_normal;
+        bool const valid
+            = this->unplaced().Normal(t->Transform(pos), local_normal);
+        normal = t->InverseTransformDirection(local_normal);
+        return valid;
+    }
+    Precision SurfaceArea() const final
+    {
+        return this->unplaced().SurfaceArea();
+    }
+
+    //!@{
+    //! \name SIMD interface
+    Real_v DistanceToInVec(Real3_v const& pos,
+                           Real3_v const& dir,
+                           Real_v const step_max) const final
+    {
+        return map_lanes([&](std::size_t i) {
+            return this->DistanceToIn(get_lane(pos, i),
+                                      get_lane(dir, i),
+                                      vecCore::Get(step_max, i));
+        });
+    }
+    Real_v DistanceToOutVec(Real3_v const& local_pos,
+                            Real3_v const& local_dir,
+                            Real_v const step_max) const final
+    {
+        return this->unplaced().DistanceToOutVec(
+            local_pos, local_dir, step_max);
+    }
+    Real_v SafetyToInVec(Real3_v const& pos) const final
+    {
+        return map_lanes([&](std::size_t i) {
+            return this->SafetyToIn(get_lane(pos, i));
+        });
+    }
+    Real_v SafetyToOutVec(Real3_v const& local_pos) const final
+    {
+        return this->unplaced().SafetyToOutVec(local_pos);
+    }
+    //!@}
+
+    //!@{
+    //! \name Container interface
+    void Contains(SOA3D const& pos, bool* output) const final
+    {
+        for (std::size_t i = 0; i != pos.size(); ++i)
+        {
+            output[i] = this->Contains(pos[i]);
+        }
+    }
+    void Inside(SOA3D const& pos, vecgeom::Inside_t* output) const final
+    {
+        for (std::size_t i = 0; i != pos.size(); ++i)
+        {
+            output[i] = this->Inside(pos[i]);
+        }
+    }
+    void DistanceToIn(SOA3D const& pos,
+                      SOA3D const& dir,
+                      Precision const* step_max,
+                      Precision* output) const final
+    {
+        for (std::size_t i = 0; i != pos.size(); ++i)
+        {
+            output[i] = this->DistanceToIn(pos[i], dir[i], step_max[i]);
+        }
+    }
+    void DistanceToInMinimize(SOA3D const& pos,
+                              SOA3D const& dir,
+                              int index,
+                              Precision* output,
+                              int* next_index) const final
+    {
+        for (std::size_t i = 0; i != pos.size(); ++i)
+        {
+            Precision const dist
+                = this->DistanceToIn(pos[i], dir[i], output[i]);
+            if (dist < output[i])
+            {
+                output[i] = dist;
+                next_index[i] = index;
+            }
+        }
+    }
+    void DistanceToOut(SOA3D const& local_pos,
+                       SOA3D const& local_dir,
+                       Precision const* step_max,
+                       Precision* output) const final
+    {
+        this->unplaced().DistanceToOut(local_pos, local_dir, step_max, output);
+    }
+    void DistanceToOut(SOA3D const& local_pos,
+                       SOA3D const& local_dir,
+                       Precision const* step_max,
+                       Precision* output,
+                       int* next_index) const final
+    {
+        this->unplaced().DistanceToOut(local_pos, local_dir, step_max, output);
+        for (std::size_t i = 0; i != local_pos.size(); ++i)
+        {
+            // Exiting the mother (-1) or not within the step (-2)
+            next_index[i] = output[i] < step_max[i] ? -1 : -2;
+        }
+    }
+    void SafetyToIn(SOA3D const& pos, Precision* output) const final
+    {
+        for (std::size_t i = 0; i != pos.size(); ++i)
+        {
+            output[i] = this->SafetyToIn(pos[i]);
+        }
+    }
+    void SafetyToInMinimize(SOA3D const& pos, Precision* output) const final
+    {
+        for (std::size_t i = 0; i != pos.size(); ++i)
+        {
+            output[i] = std::min(output[i], this->SafetyToIn(pos[i]));
+        }
+    }
+    void SafetyToOut(SOA3D const& local_pos, Precision* output) const final
+    {
+        this->unplaced().SafetyToOut(local_pos, output);
+    }
+    void
+    SafetyToOutMinimize(SOA3D const& local_pos, Precision* output) const final
+    {
+        for (std::size_t i = 0; i != local_pos.size(); ++i)
+        {
+            output[i] = std::min(output[i], this->SafetyToOut(local_pos[i]));
+        }
+    }
+    //!@}
+
+    //!@{
+    //! \name Conversion
+    //! There are no specializations
+    vecgeom::VPlacedVolume const* ConvertToUnspecialized() const final
+    {
+        return this;
+    }
+#ifdef VECGEOM_ROOT
+    //! ROOT has no equivalent of an arbitrary Geant4 solid
+    TGeoShape const* ConvertToRoot() const final { return nullptr; }
+#endif
+#ifdef VECGEOM_GEANT4
+    //! The wrapped solid is already a Geant4 solid
+    G4VSolid const* ConvertToGeant4() const final
+    {
+        return &this->unplaced().solid();
+    }
+#endif
+    //!@}
+
+  private:
+    UnplacedWrappedSolid const& unplaced() const
+    {
+        return static_cast<UnplacedWrappedSolid const&>(
+            *this->GetUnplacedVolume());
+    }
+    Real3 to_local(Real3 const& pos) const
+    {
+        return this->GetTransformation()->Transform(pos);
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count and time one call into the Geant4 solid.
+ */
+class UnplacedWrappedSolid::ScopedTimer
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ScopedTimer(UnplacedWrappedSolid const& shape)
+        : shape_{shape}, start_{Clock::now()}
+    {
+    }
+
+    ~ScopedTimer()
+    {
+        auto const elapsed = std::chrono::duration_cast<
+            std::chrono::nanoseconds>(Clock::now() - start_);
+        shape_.calls_.fetch_add(1, std::memory_order_relaxed);
+        shape_.nanoseconds_.fetch_add(elapsed.count(),
+                                      std::memory_order_relaxed);
+    }
+
+  private:
+    UnplacedWrappedSolid const& shape_;
+    Clock::time_point start_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the solid and the length scale of the VecGeom geometry.
+ */
+UnplacedWrappedSolid::UnplacedWrappedSolid(G4VSolid const* solid,
+                                           double scale)
+    : solid_{const_cast<G4VSolid*>(solid)}, scale_{scale}
+{
+    if (!solid_)
+    {
+        throw std::invalid_argument("cannot wrap a null solid");
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time spent in the Geant4 solid [s].
+ */
+double UnplacedWrappedSolid::seconds() const
+{
+    return 1e-9 * nanoseconds_.load(std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------//
+bool UnplacedWrappedSolid::Contains(Real3 const& pos) const
+{
+    return this->Inside(pos) != vecgeom::EInside::kOutside;
+}
+
+//---------------------------------------------------------------------------//
+vecgeom::EnumInside UnplacedWrappedSolid::Inside(Real3 const& pos) const
+{
+    ScopedTimer timer{*this};
+    switch (solid_->Inside(to_g4(pos, 1 / scale_)))
+    {
+        case kInside:
+            return vecgeom::EInside::kInside;
+        case kSurface:
+            return vecgeom::EInside::kSurface;
+        case kOutside:
+            break;
+    }
+    return vecgeom::EInside::kOutside;
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::DistanceToIn(Real3 const& pos,
+                                        Real3 const& dir,
+                                        Precision) const -> Precision
+{
+    ScopedTimer timer{*this};
+    double const dist = solid_->DistanceToIn(to_g4(pos, 1 / scale_),
+                                             to_g4(dir, 1));
+    return dist == kInfinity ? vecgeom::kInfLength : scale_ * dist;
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::DistanceToOut(Real3 const& pos,
+                                         Real3 const& dir,
+                                         Precision) const -> Precision
+{
+    ScopedTimer timer{*this};
+    G4ThreeVector const g4pos = to_g4(pos, 1 / scale_);
+    double const dist = solid_->DistanceToOut(g4pos, to_g4(dir, 1));
+    return from_g4(dist, scale_, *solid_, g4pos, kOutside);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Distance to exit, with the exiting normal.
+ *
+ * The convexity flag is Geant4's \c validNorm: whether the solid lies entirely
+ * behind the exiting surface.
+ */
+auto UnplacedWrappedSolid::DistanceToOut(Real3 const& pos,
+                                         Real3 const& dir,
+                                         Real3& normal,
+                                         bool& convex,
+                                         Precision) const -> Precision
+{
+    ScopedTimer timer{*this};
+    G4ThreeVector const g4pos = to_g4(pos, 1 / scale_);
+    G4ThreeVector const g4dir = to_g4(dir, 1);
+    G4bool valid_norm = false;
+    G4ThreeVector n;
+    double const dist
+        = solid_->DistanceToOut(g4pos, g4dir, true, &valid_norm, &n);
+    if (from_g4(dist, scale_, *solid_, g4pos, kOutside) < 0)
+    {
+        normal = Real3(0, 0, 0);
+        convex = false;
+        return -1;
+    }
+    if (!valid_norm)
+    {
+        n = solid_->SurfaceNormal(g4pos + dist * g4dir);
+    }
+    normal = Real3(n.x(), n.y(), n.z());
+    convex = valid_norm;
+    return scale_ * dist;
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::SafetyToIn(Real3 const& pos) const -> Precision
+{
+    ScopedTimer timer{*this};
+    G4ThreeVector const g4pos = to_g4(pos, 1 / scale_);
+    double const dist = solid_->DistanceToIn(g4pos);
+    return from_g4(dist, scale_, *solid_, g4pos, kInside);
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::SafetyToOut(Real3 const& pos) const -> Precision
+{
+    ScopedTimer timer{*this};
+    G4ThreeVector const g4pos = to_g4(pos, 1 / scale_);
+    double const dist = solid_->DistanceToOut(g4pos);
+    return from_g4(dist, scale_, *solid_, g4pos, kOutside);
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::DistanceToInVec(Real3_v const& pos,
+                                           Real3_v const& dir,
+                                           Real_v const& step_max) const
+    -> Real_v
+{
+    return map_lanes([&](std::size_t i) {
+        return this->DistanceToIn(
+            get_lane(pos, i), get_lane(dir, i), vecCore::Get(step_max, i));
+    });
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::DistanceToOutVec(Real3_v const& pos,
+                                            Real3_v const& dir,
+                                            Real_v const& step_max) const
+    -> Real_v
+{
+    return map_lanes([&](std::size_t i) {
+        return this->DistanceToOut(
+            get_lane(pos, i), get_lane(dir, i), vecCore::Get(step_max, i));
+    });
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::SafetyToInVec(Real3_v const& pos) const -> Real_v
+{
+    return map_lanes(
+        [&](std::size_t i) { return this->SafetyToIn(get_lane(pos, i)); });
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::SafetyToOutVec(Real3_v const& pos) const -> Real_v
+{
+    return map_lanes(
+        [&](std::size_t i) { return this->SafetyToOut(get_lane(pos, i)); });
+}
+
+//---------------------------------------------------------------------------//
+void UnplacedWrappedSolid::DistanceToOut(SOA3D const& pos,
+                                         SOA3D const& dir,
+                                         Precision const* step_max,
+                                         Precision* output) const
+{
+    for (std::size_t i = 0; i != pos.size(); ++i)
+    {
+        output[i] = this->DistanceToOut(pos[i], dir[i], step_max[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void UnplacedWrappedSolid::SafetyToOut(SOA3D const& pos,
+                                       Precision* output) const
+{
+    for (std::size_t i = 0; i != pos.size(); ++i)
+    {
+        output[i] = this->SafetyToOut(pos[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool UnplacedWrappedSolid::Normal(Real3 const& pos, Real3& normal) const
+{
+    ScopedTimer timer{*this};
+    auto const n = solid_->SurfaceNormal(to_g4(pos, 1 / scale_));
+    normal = Real3(n.x(), n.y(), n.z());
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void UnplacedWrappedSolid::Extent(Real3& lower, Real3& upper) const
+{
+    ScopedTimer timer{*this};
+    G4ThreeVector lo;
+    G4ThreeVector hi;
+    solid_->BoundingLimits(lo, hi);
+    lower = Real3(scale_ * lo.x(), scale_ * lo.y(), scale_ * lo.z());
+    upper = Real3(scale_ * hi.x(), scale_ * hi.y(), scale_ * hi.z());
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::Capacity() const -> Precision
+{
+    ScopedTimer timer{*this};
+    return scale_ * scale_ * scale_ * solid_->GetCubicVolume();
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::SurfaceArea() const -> Precision
+{
+    ScopedTimer timer{*this};
+    return scale_ * scale_ * solid_->GetSurfaceArea();
+}
+
+//---------------------------------------------------------------------------//
+auto UnplacedWrappedSolid::SamplePointOnSurface() const -> Real3
+{
+    ScopedTimer timer{*this};
+    auto const p = solid_->GetPointOnSurface();
+    return Real3(scale_ * p.x(), scale_ * p.y(), scale_ * p.z());
+}
+
+//---------------------------------------------------------------------------//
+void UnplacedWrappedSolid::Print() const
+{
+    this->Print(std::cout);
+}
+
+//---------------------------------------------------------------------------//
+void UnplacedWrappedSolid::Print(std::ostream& os) const
+{
+    os << "UnplacedWrappedSolid{" << solid_->GetEntityType() << " '"
+       << solid_->GetName() << "'}";
+}
+
+//---------------------------------------------------------------------------//
+int UnplacedWrappedSolid::MemorySize() const
+{
+    return sizeof(*this);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a placement; there are no specializations.
+ */
+vecgeom::VPlacedVolume* UnplacedWrappedSolid::SpecializedVolume(
+    vecgeom::LogicalVolume const* volume,
+    vecgeom::Transformation3D const* transformation,
+    vecgeom::TranslationCode,
+    vecgeom::RotationCode,
+    vecgeom::VPlacedVolume* placement) const
+{
+    if (placement)
+    {
+        return new (placement) PlacedWrappedSolid(volume, transformation);
+    }
+    return new PlacedWrappedSolid(volume, transformation);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
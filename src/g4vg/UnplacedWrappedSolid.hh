@@ -0,0 +1,120 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/UnplacedWrappedSolid.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <VecGeom/volumes/UnplacedVolume.h>
+
+class G4VSolid;
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * A VecGeom shape that forwards to a Geant4 solid.
+ *
+ * This lets geometries with a few unsupported (e.g., experiment-specific)
+ * solids be converted: navigation in those shapes goes through the Geant4
+ * implementation, while the rest of the geometry uses native VecGeom shapes.
+ * Each call is counted and timed so that the cost of the fallback can be
+ * measured. The SIMD and container interfaces loop over the scalar calls, and
+ * wrapped shapes cannot be copied to a GPU. Distances and safeties from the
+ * wrong side of the solid are negative as in VecGeom, not zero as in Geant4.
+ *
+ * The Geant4 solid must outlive this shape.
+ */
+class UnplacedWrappedSolid final : public vecgeom::VUnplacedVolume
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Precision = vecgeom::Precision;
+    using Real3 = vecgeom::Vector3D<Precision>;
+    using Real_v = vecgeom::VectorBackend::Real_v;
+    using Real3_v = vecgeom::Vector3D<Real_v>;
+    using SOA3D = vecgeom::SOA3D<Precision>;
+    //!@}
+
+  public:
+    // Construct with the solid and the length scale of the VecGeom geometry
+    UnplacedWrappedSolid(G4VSolid const* solid, double scale);
+
+    //! Wrapped Geant4 solid
+    G4VSolid const& solid() const { return *solid_; }
+
+    //! Number of calls into the Geant4 solid
+    std::uint64_t calls() const
+    {
+        return calls_.load(std::memory_order_relaxed);
+    }
+
+    // Time spent in the Geant4 solid [s]
+    double seconds() const;
+
+    //!@{
+    //! \name VecGeom interface
+    bool Contains(Real3 const& pos) const final;
+    vecgeom::EnumInside Inside(Real3 const& pos) const final;
+    Precision DistanceToIn(Real3 const& pos,
+                           Real3 const& dir,
+                           Precision step_max
+                           = vecgeom::kInfLength) const final;
+    Precision DistanceToOut(Real3 const& pos,
+                            Real3 const& dir,
+                            Precision step_max
+                            = vecgeom::kInfLength) const final;
+    Precision DistanceToOut(Real3 const& pos,
+                            Real3 const& dir,
+                            Real3& normal,
+                            bool& convex,
+                            Precision step_max
+                            = vecgeom::kInfLength) const final;
+    Precision SafetyToIn(Real3 const& pos) const final;
+    Precision SafetyToOut(Real3 const& pos) const final;
+    Real_v DistanceToInVec(Real3_v const& pos,
+                           Real3_v const& dir,
+                           Real_v const& step_max) const final;
+    Real_v DistanceToOutVec(Real3_v const& pos,
+                            Real3_v const& dir,
+                            Real_v const& step_max) const final;
+    Real_v SafetyToInVec(Real3_v const& pos) const final;
+    Real_v SafetyToOutVec(Real3_v const& pos) const final;
+    void DistanceToOut(SOA3D const& pos,
+                       SOA3D const& dir,
+                       Precision const* step_max,
+                       Precision* output) const final;
+    void SafetyToOut(SOA3D const& pos, Precision* output) const final;
+    bool Normal(Real3 const& pos, Real3& normal) const final;
+    void Extent(Real3& lower, Real3& upper) const final;
+    Precision Capacity() const final;
+    Precision SurfaceArea() const final;
+    Real3 SamplePointOnSurface() const final;
+    void Print() const final;
+    void Print(std::ostream& os) const final;
+    int MemorySize() const final;
+    vecgeom::VPlacedVolume*
+    SpecializedVolume(vecgeom::LogicalVolume const* volume,
+                      vecgeom::Transformation3D const* transformation,
+                      vecgeom::TranslationCode,
+                      vecgeom::RotationCode,
+                      vecgeom::VPlacedVolume* placement) const final;
+    //!@}
+
+  private:
+    class ScopedTimer;
+
+    // Geant4 caches volume and surface area inside the solid
+    G4VSolid* solid_;
+    double scale_;
+    mutable std::atomic<std::uint64_t> calls_{0};
+    mutable std::atomic<std::uint64_t> nanoseconds_{0};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
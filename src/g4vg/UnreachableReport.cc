@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/UnreachableReport.cc
+//---------------------------------------------------------------------------//
+#include "UnreachableReport.hh"
+
+#include <unordered_set>
+#include <vector>
+#include <G4BooleanSolid.hh>
+#include <G4DisplacedSolid.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4MultiUnion.hh>
+#include <G4PhysicalVolumeStore.hh>
+#include <G4ReflectedSolid.hh>
+#include <G4ScaledSolid.hh>
+#include <G4SolidStore.hh>
+#include <G4VPhysicalVolume.hh>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Add a solid and any solids it is built from.
+ */
+void insert_solid(G4VSolid const* solid,
+                  std::unordered_set<G4VSolid const*>* solids)
+{
+    while (solid && solids->insert(solid).second)
+    {
+        if (auto* boolean = dynamic_cast<G4BooleanSolid const*>(solid))
+        {
+            insert_solid(boolean->GetConstituentSolid(0), solids);
+            solid = boolean->GetConstituentSolid(1);
+        }
+        else if (auto* disp = dynamic_cast<G4DisplacedSolid const*>(solid))
+        {
+            solid = disp->GetConstituentMovedSolid();
+        }
+        else if (auto* refl = dynamic_cast<G4ReflectedSolid const*>(solid))
+        {
+            solid = refl->GetConstituentMovedSolid();
+        }
+        else if (auto* scaled = dynamic_cast<G4ScaledSolid const*>(solid))
+        {
+            solid = scaled->GetUnscaledSolid();
+        }
+        else if (auto* multi = dynamic_cast<G4MultiUnion const*>(solid))
+        {
+            for (int i = 0; i != multi->GetNumberOfSolids(); ++i)
+            {
+                insert_solid(multi->GetSolid(i), solids);
+            }
+            solid = nullptr;
+        }
+        else
+        {
+            solid = nullptr;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<class T, class Store>
+std::size_t count_missing(Store const& store,
+                          std::unordered_set<T const*> const& found)
+{
+    std::size_t result = 0;
+    for (auto const* obj : store)
+    {
+        result += (found.count(obj) == 0);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count Geant4 objects in the stores that are unreachable from the world.
+ *
+ * Solids that are constituents of reachable boolean, displaced, reflected,
+ * scaled, or multi-union solids are reachable.
+ */
+UnreachableReport find_unreachable(G4VPhysicalVolume const* world)
+{
+    std::unordered_set<G4VPhysicalVolume const*> pvs;
+    std::unordered_set<G4LogicalVolume const*> lvs;
+    std::unordered_set<G4VSolid const*> solids;
+
+    std::vector<G4VPhysicalVolume const*> stack{world};
+    while (!stack.empty())
+    {
+        G4VPhysicalVolume const* pv = stack.back();
+        stack.pop_back();
+        pvs.insert(pv);
+
+        G4LogicalVolume const* lv = pv->GetLogicalVolume();
+        if (!lvs.insert(lv).second)
+        {
+            continue;
+        }
+        insert_solid(lv->GetSolid(), &solids);
+        for (std::size_t i = 0; i != lv->GetNoDaughters(); ++i)
+        {
+            stack.push_back(lv->GetDaughter(i));
+        }
+    }
+
+    UnreachableReport result;
+    result.logical_volumes
+        = count_missing(*G4LogicalVolumeStore::GetInstance(), lvs);
+    result.physical_volumes
+        = count_missing(*G4PhysicalVolumeStore::GetInstance(), pvs);
+    result.solids = count_missing(*G4SolidStore::GetInstance(), solids);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/UnreachableReport.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+
+class G4VPhysicalVolume;
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Geant4 objects that exist in the stores but not in the world tree.
+ *
+ * Detector builders and GDML files often create volumes and solids that are
+ * never placed. The converter only visits objects reachable from the world,
+ * so these are never converted; this report quantifies what was skipped.
+ *
+ * The memory and time estimates are extrapolated from the average cost per
+ * converted logical volume and are only filled in by \c g4vg::convert .
+ */
+struct UnreachableReport
+{
+    std::size_t logical_volumes{0};
+    std::size_t physical_volumes{0};
+    std::size_t solids{0};
+
+    //! Estimated VecGeom memory not allocated [bytes]
+    std::size_t estimated_bytes{0};
+    //! Estimated conversion time not spent [s]
+    double estimated_seconds{0};
+
+    //! Whether any unreachable objects were found
+    explicit operator bool() const
+    {
+        return logical_volumes || physical_volumes || solids;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Count Geant4 objects in the stores that are unreachable from the world
+UnreachableReport find_unreachable(G4VPhysicalVolume const* world);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeAttributes.cc
+//---------------------------------------------------------------------------//
+#include "VolumeAttributes.hh"
+
+#include <unordered_map>
+#include <G4GDMLAuxStructType.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Region.hh>
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the dense index of an object, adding it if it's new.
+ */
+template<class T>
+unsigned int
+insert_unique(T const* obj,
+              std::unordered_map<T const*, unsigned int>* ids,
+              std::vector<T const*>* objects)
+{
+    auto [iter, inserted]
+        = ids->insert({obj, static_cast<unsigned int>(objects->size())});
+    if (inserted)
+    {
+        objects->push_back(obj);
+    }
+    return iter->second;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build volume attributes from the Geant4 volume of each volume ID.
+ *
+ * Regions and production cuts are numbered in order of first use by
+ * increasing volume ID. Nested GDML auxiliary lists are not included.
+ */
+VolumeAttributes build_volume_attributes(
+    std::vector<G4LogicalVolume const*> const& logical_volumes,
+    GdmlAuxMap const* gdml_aux)
+{
+    VolumeAttributes result;
+    auto const num_volumes = logical_volumes.size();
+    result.volume_region.assign(num_volumes, VolumeAttributes::invalid_id);
+    result.volume_cuts.assign(num_volumes, VolumeAttributes::invalid_id);
+    result.sensitive.assign(num_volumes, false);
+    result.field.assign(num_volumes, false);
+    result.aux_offsets.reserve(num_volumes + 1);
+    result.aux_offsets.push_back(0);
+
+    std::unordered_map<G4Region const*, unsigned int> region_ids;
+    std::unordered_map<G4ProductionCuts const*, unsigned int> cuts_ids;
+    for (std::size_t id = 0; id != num_volumes; ++id)
+    {
+        G4LogicalVolume const* lv = logical_volumes[id];
+        if (lv)
+        {
+            if (G4Region const* region = lv->GetRegion())
+            {
+                auto region_id
+                    = insert_unique(region, &region_ids, &result.regions);
+                if (region_id == result.region_cuts.size())
+                {
+                    G4ProductionCuts const* cuts = region->GetProductionCuts();
+                    result.region_cuts.push_back(
+                        cuts ? insert_unique(
+                                   cuts, &cuts_ids, &result.production_cuts)
+                             : VolumeAttributes::invalid_id);
+                }
+                result.volume_region[id] = region_id;
+                result.volume_cuts[id] = result.region_cuts[region_id];
+            }
+            result.sensitive[id] = (lv->GetSensitiveDetector() != nullptr);
+            result.field[id] = (lv->GetFieldManager() != nullptr);
+
+            if (gdml_aux)
+            {
+                auto iter
+                    = gdml_aux->find(const_cast<G4LogicalVolume*>(lv));
+                if (iter != gdml_aux->end())
+                {
+                    for (G4GDMLAuxStructType const& a : iter->second)
+                    {
+                        result.aux.push_back({a.type, a.value, a.unit});
+                    }
+                }
+            }
+        }
+        result.aux_offsets.push_back(
+            static_cast<unsigned int>(result.aux.size()));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeAttributes.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+class G4LogicalVolume;
+class G4ProductionCuts;
+class G4Region;
+struct G4GDMLAuxStructType;
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+//! GDML auxiliary data for each volume (same as \c G4GDMLAuxMapType )
+using GdmlAuxMap
+    = std::map<G4LogicalVolume*, std::vector<G4GDMLAuxStructType>>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport-relevant Geant4 volume attributes indexed by volume ID.
+ *
+ * Regions and production cuts are deduplicated into dense tables, and each
+ * volume stores its region and cuts index so the hot path can check them
+ * with a single array load. Sensitivity and field managers are packed into
+ * bitsets. GDML auxiliary tags are stored in compressed sparse row format:
+ * the tags for volume \c i are <code>aux[aux_offsets[i]]</code> up to
+ * <code>aux[aux_offsets[i + 1]]</code>.
+ *
+ * The production cuts index refers to the region's \c G4ProductionCuts
+ * rather than to a \c G4MaterialCutsCouple , since couples are only created
+ * when the run is initialized, after the geometry is converted.
+ *
+ * Volumes without a region (e.g. before the world region is set up by the run
+ * manager) map to \c invalid_id .
+ */
+struct VolumeAttributes
+{
+    //! Sentinel for a missing region or production cuts
+    static constexpr unsigned int invalid_id = static_cast<unsigned int>(-1);
+
+    //! GDML auxiliary tag attached to a volume
+    struct Auxiliary
+    {
+        std::string type;
+        std::string value;
+        std::string unit;
+    };
+
+    using AuxRange = std::pair<Auxiliary const*, Auxiliary const*>;
+
+    //!@{
+    //! \name Per-region data
+    std::vector<G4Region const*> regions;
+    std::vector<unsigned int> region_cuts;  //!< Production cuts ID
+    //!@}
+
+    //! Unique production cuts
+    std::vector<G4ProductionCuts const*> production_cuts;
+
+    //!@{
+    //! \name Per-volume data
+    std::vector<unsigned int> volume_region;
+    std::vector<unsigned int> volume_cuts;
+    std::vector<bool> sensitive;  //!< Has a sensitive detector
+    std::vector<bool> field;  //!< Has its own field manager
+    std::vector<unsigned int> aux_offsets;  //!< Size is num volumes + 1
+    //!@}
+
+    //! GDML auxiliary data for all volumes
+    std::vector<Auxiliary> aux;
+
+    //! Number of volume IDs
+    unsigned int num_volumes() const
+    {
+        return static_cast<unsigned int>(volume_region.size());
+    }
+
+    //! GDML auxiliary tags for a volume
+    AuxRange auxiliary(unsigned int volume) const
+    {
+        return {aux.data() + aux_offsets[volume],
+                aux.data() + aux_offsets[volume + 1]};
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Build volume attributes from the Geant4 volume of each volume ID
+VolumeAttributes build_volume_attributes(
+    std::vector<G4LogicalVolume const*> const& logical_volumes,
+    GdmlAuxMap const* gdml_aux);
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,175 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeIds.cc
+//---------------------------------------------------------------------------//
+#include "VolumeIds.hh"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "VolumeStore.hh"
+
+namespace g4vg
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Build the reverse lookup, appending owned objects that are not yet listed.
+ */
+template<class T>
+void index_objects(std::vector<T*> const& owned,
+                   std::vector<T const*>* objects,
+                   unsigned int* base,
+                   std::vector<unsigned int>* ids)
+{
+    unsigned int lo = VolumeIds::invalid_id;
+    unsigned int hi = 0;
+    auto bound = [&lo, &hi](T const* obj) {
+        lo = std::min(lo, obj->id());
+        hi = std::max(hi, obj->id());
+    };
+    std::for_each(objects->begin(), objects->end(), bound);
+    std::for_each(owned.begin(), owned.end(), bound);
+    if (lo > hi)
+    {
+        return;
+    }
+
+    *base = lo;
+    ids->assign(hi - lo + 1, VolumeIds::invalid_id);
+    for (std::size_t i = 0; i != objects->size(); ++i)
+    {
+        (*ids)[(*objects)[i]->id() - lo] = static_cast<unsigned int>(i);
+    }
+    for (T const* obj : owned)
+    {
+        auto& id = (*ids)[obj->id() - lo];
+        if (id == VolumeIds::invalid_id)
+        {
+            id = static_cast<unsigned int>(objects->size());
+            objects->push_back(obj);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number the volumes reachable from a world.
+ */
+VolumeIds::VolumeIds(VGPlacedVolume const* world)
+    : VolumeIds{world, VolumeStore{}}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number reachable volumes, then the other volumes owned by a store.
+ */
+VolumeIds::VolumeIds(VGPlacedVolume const* world, VolumeStore const& store)
+{
+    if (!world)
+    {
+        throw std::invalid_argument("cannot number a null world volume");
+    }
+
+    // Number logical volumes in post-order
+    struct Frame
+    {
+        VGLogicalVolume const* lv;
+        std::size_t next_daughter;
+    };
+    std::unordered_set<VGLogicalVolume const*> visited;
+    std::vector<Frame> stack;
+    auto visit = [&visited, &stack](VGLogicalVolume const* lv) {
+        if (visited.insert(lv).second)
+        {
+            stack.push_back({lv, 0});
+        }
+    };
+    visit(world->GetLogicalVolume());
+    while (!stack.empty())
+    {
+        Frame& top = stack.back();
+        auto const& daughters = top.lv->GetDaughters();
+        if (top.next_daughter == daughters.size())
+        {
+            volumes_.push_back(top.lv);
+            stack.pop_back();
+            continue;
+        }
+        visit(daughters[top.next_daughter++]->GetLogicalVolume());
+    }
+
+    // Number placements by mother, then the world
+    for (auto const* lv : volumes_)
+    {
+        for (auto const* pv : lv->GetDaughters())
+        {
+            placements_.push_back(pv);
+        }
+    }
+    placements_.push_back(world);
+
+    num_volumes_ = static_cast<unsigned int>(volumes_.size());
+    num_placements_ = static_cast<unsigned int>(placements_.size());
+    index_objects(store.volumes(), &volumes_, &lv_base_, &lv_ids_);
+    index_objects(store.placed(), &placements_, &pv_base_, &pv_ids_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * ID of a logical volume, or \c invalid_id if it is not numbered.
+ */
+unsigned int VolumeIds::id(VGLogicalVolume const& lv) const
+{
+    unsigned int const i = lv.id() - lv_base_;
+    return lv.id() >= lv_base_ && i < lv_ids_.size() ? lv_ids_[i]
+                                                     : invalid_id;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * ID of a placement, or \c invalid_id if it is not numbered.
+ */
+unsigned int VolumeIds::id(VGPlacedVolume const& pv) const
+{
+    unsigned int const i = pv.id() - pv_base_;
+    return pv.id() >= pv_base_ && i < pv_ids_.size() ? pv_ids_[i]
+                                                     : invalid_id;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Heap memory used by the lookup tables.
+ */
+std::size_t VolumeIds::memory_bytes() const
+{
+    return volumes_.capacity() * sizeof(VGLogicalVolume const*)
+           + placements_.capacity() * sizeof(VGPlacedVolume const*)
+           + (lv_ids_.capacity() + pv_ids_.capacity()) * sizeof(unsigned int);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release excess capacity.
+ */
+void VolumeIds::shrink_to_fit()
+{
+    volumes_.shrink_to_fit();
+    placements_.shrink_to_fit();
+    lv_ids_.shrink_to_fit();
+    pv_ids_.shrink_to_fit();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
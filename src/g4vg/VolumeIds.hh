@@ -0,0 +1,129 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeIds.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace vecgeom
+{
+inline namespace cxx
+{
+class LogicalVolume;
+class VPlacedVolume;
+}  // namespace cxx
+}  // namespace vecgeom
+
+namespace g4vg
+{
+class VolumeStore;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Dense, deterministic IDs for the volumes and placements of a geometry.
+ *
+ * VecGeom IDs are global to the process: they depend on everything created
+ * before the conversion, and helper volumes for boolean constituents take
+ * IDs between those of the real volumes. g4vg tables are instead indexed by
+ * IDs that depend only on the geometry:
+ * - Logical volumes reachable from the world are numbered in post-order
+ *   (each volume's daughters before the volume itself, in daughter order),
+ *   so the world volume has ID <code>num_volumes() - 1</code>.
+ * - Placements are numbered by mother volume ID, then by daughter order, and
+ *   the world placement is last. The daughters of each mother therefore have
+ *   consecutive IDs.
+ * - Helper volumes and placements that are owned by a \c VolumeStore but not
+ *   reachable from the world are numbered afterward in order of creation.
+ *
+ * Per-volume and per-placement tables have exactly \c num_volumes and
+ * \c num_placements entries.
+ */
+class VolumeIds
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VGLogicalVolume = vecgeom::LogicalVolume;
+    using VGPlacedVolume = vecgeom::VPlacedVolume;
+    using VecLv = std::vector<VGLogicalVolume const*>;
+    using VecPv = std::vector<VGPlacedVolume const*>;
+    //!@}
+
+    //! ID of an object that is not numbered
+    static constexpr unsigned int invalid_id = static_cast<unsigned int>(-1);
+
+  public:
+    // Construct empty
+    VolumeIds() = default;
+
+    // Number the volumes reachable from a world
+    explicit VolumeIds(VGPlacedVolume const* world);
+
+    // Number reachable volumes, then the other volumes owned by a store
+    VolumeIds(VGPlacedVolume const* world, VolumeStore const& store);
+
+    //! Number of logical volumes reachable from the world
+    unsigned int num_volumes() const { return num_volumes_; }
+
+    //! Number of placements reachable from the world, including the world
+    unsigned int num_placements() const { return num_placements_; }
+
+    //! Logical volumes by ID, including helpers
+    VecLv const& all_volumes() const { return volumes_; }
+
+    //! Placements by ID, including helpers
+    VecPv const& all_placements() const { return placements_; }
+
+    //! Get a logical volume
+    VGLogicalVolume const* volume(unsigned int id) const
+    {
+        return volumes_[id];
+    }
+
+    //! Get a placement
+    VGPlacedVolume const* placement(unsigned int id) const
+    {
+        return placements_[id];
+    }
+
+    //! World placement
+    VGPlacedVolume const* world() const
+    {
+        return num_placements_ ? placements_[num_placements_ - 1] : nullptr;
+    }
+
+    // ID of a logical volume, or invalid_id
+    unsigned int id(VGLogicalVolume const& lv) const;
+
+    // ID of a placement, or invalid_id
+    unsigned int id(VGPlacedVolume const& pv) const;
+
+    //! Whether nothing is numbered
+    bool empty() const { return volumes_.empty(); }
+
+    // Heap memory used by the lookup tables
+    std::size_t memory_bytes() const;
+
+    // Release excess capacity
+    void shrink_to_fit();
+
+  private:
+    unsigned int num_volumes_{0};
+    unsigned int num_placements_{0};
+    VecLv volumes_;
+    VecPv placements_;
+
+    // Lookup from VecGeom ID (minus the lowest one) to our ID
+    unsigned int lv_base_{0};
+    unsigned int pv_base_{0};
+    std::vector<unsigned int> lv_ids_;
+    std::vector<unsigned int> pv_ids_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
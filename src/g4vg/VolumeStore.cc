@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeStore.cc
+//---------------------------------------------------------------------------//
+#include "VolumeStore.hh"
+
+#include <utility>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+#include <VecGeom/volumes/UnplacedVolume.h>
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Delete all owned objects.
+ */
+VolumeStore::~VolumeStore()
+{
+    this->clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership from another store.
+ */
+VolumeStore::VolumeStore(VolumeStore&& other) noexcept
+    : shapes_{std::move(other.shapes_)}
+    , volumes_{std::move(other.volumes_)}
+    , placed_{std::move(other.placed_)}
+{
+    other.release();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Delete owned objects and take ownership from another store.
+ */
+VolumeStore& VolumeStore::operator=(VolumeStore&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->clear();
+        shapes_ = std::move(other.shapes_);
+        volumes_ = std::move(other.volumes_);
+        placed_ = std::move(other.placed_);
+        other.release();
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership of a newly created shape.
+ */
+void VolumeStore::insert(VGUnplacedVolume const* shape)
+{
+    shapes_.push_back(shape);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership of a newly created logical volume.
+ */
+void VolumeStore::insert(VGLogicalVolume* volume)
+{
+    volumes_.push_back(volume);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership of a newly created placed volume.
+ */
+void VolumeStore::insert(VGPlacedVolume* placed)
+{
+    placed_.push_back(placed);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Delete all owned objects.
+ *
+ * Placements refer to logical volumes, which refer to shapes, so they are
+ * deleted in that order, each in reverse order of creation.
+ */
+void VolumeStore::clear()
+{
+    for (auto iter = placed_.rbegin(); iter != placed_.rend(); ++iter)
+    {
+        delete *iter;
+    }
+    for (auto iter = volumes_.rbegin(); iter != volumes_.rend(); ++iter)
+    {
+        delete *iter;
+    }
+    for (auto iter = shapes_.rbegin(); iter != shapes_.rend(); ++iter)
+    {
+        delete *iter;
+    }
+    this->release();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop owning all objects without deleting them.
+ */
+void VolumeStore::release()
+{
+    std::vector<VGUnplacedVolume const*>{}.swap(shapes_);
+    std::vector<VGLogicalVolume*>{}.swap(volumes_);
+    std::vector<VGPlacedVolume*>{}.swap(placed_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release unused bookkeeping capacity.
+ */
+void VolumeStore::shrink_to_fit()
+{
+    shapes_.shrink_to_fit();
+    volumes_.shrink_to_fit();
+    placed_.shrink_to_fit();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Memory used for bookkeeping [bytes].
+ */
+std::size_t VolumeStore::memory_bytes() const
+{
+    return shapes_.capacity() * sizeof(VGUnplacedVolume const*)
+           + volumes_.capacity() * sizeof(VGLogicalVolume*)
+           + placed_.capacity() * sizeof(VGPlacedVolume*);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace vecgeom
+{
+inline namespace cxx
+{
+class LogicalVolume;
+class VPlacedVolume;
+class VUnplacedVolume;
+}  // namespace cxx
+}  // namespace vecgeom
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Own the VecGeom objects created by a conversion.
+ *
+ * \c vecgeom::GeoManager::Clear forgets volumes without deleting them, so a
+ * process that converts many geometries would otherwise grow without bound.
+ * Destroying the store deletes its placed volumes, then logical volumes,
+ * then shapes; VecGeom deregisters each volume from the geometry manager as
+ * it is deleted.
+ *
+ * A world closed with \c GeoManager::SetWorldAndClose must not be navigated
+ * after its store is destroyed. Call \c release to leave the objects alive
+ * for the rest of the program instead.
+ */
+class VolumeStore
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VGLogicalVolume = vecgeom::LogicalVolume;
+    using VGPlacedVolume = vecgeom::VPlacedVolume;
+    using VGUnplacedVolume = vecgeom::VUnplacedVolume;
+    //!@}
+
+  public:
+    VolumeStore() = default;
+    ~VolumeStore();
+
+    //!@{
+    //! Move-only
+    VolumeStore(VolumeStore&& other) noexcept;
+    VolumeStore& operator=(VolumeStore&& other) noexcept;
+    VolumeStore(VolumeStore const&) = delete;
+    VolumeStore& operator=(VolumeStore const&) = delete;
+    //!@}
+
+    //!@{
+    //! Take ownership of a newly created object
+    void insert(VGUnplacedVolume const* shape);
+    void insert(VGLogicalVolume* volume);
+    void insert(VGPlacedVolume* placed);
+    //!@}
+
+    // Delete all owned objects
+    void clear();
+
+    // Stop owning all objects without deleting them
+    void release();
+
+    // Release unused bookkeeping capacity
+    void shrink_to_fit();
+
+    //! Number of owned objects
+    std::size_t size() const
+    {
+        return shapes_.size() + volumes_.size() + placed_.size();
+    }
+
+    //! Whether nothing is owned
+    bool empty() const { return this->size() == 0; }
+
+    //! Owned logical volumes in order of creation
+    std::vector<VGLogicalVolume*> const& volumes() const { return volumes_; }
+
+    //! Owned placed volumes in order of creation
+    std::vector<VGPlacedVolume*> const& placed() const { return placed_; }
+
+    // Memory used for bookkeeping [bytes]
+    std::size_t memory_bytes() const;
+
+  private:
+    std::vector<VGUnplacedVolume const*> shapes_;
+    std::vector<VGLogicalVolume*> volumes_;
+    std::vector<VGPlacedVolume*> placed_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
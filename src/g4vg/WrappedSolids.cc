@@ -0,0 +1,43 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/WrappedSolids.cc
+//---------------------------------------------------------------------------//
+#include "WrappedSolids.hh"
+
+#include "UnplacedWrappedSolid.hh"
+
+namespace g4vg
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Total number of calls into Geant4 solids.
+ */
+std::uint64_t WrappedSolids::calls() const
+{
+    std::uint64_t result = 0;
+    for (auto const* shape : shapes)
+    {
+        result += shape->calls();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total time spent in Geant4 solids [s].
+ */
+double WrappedSolids::seconds() const
+{
+    double result = 0;
+    for (auto const* shape : shapes)
+    {
+        result += shape->seconds();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/WrappedSolids.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace g4vg
+{
+class UnplacedWrappedSolid;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Geant4 solids that were wrapped instead of converted.
+ *
+ * The counters are live: they include every navigation call made through the
+ * wrapped shapes up to the time they are read.
+ */
+struct WrappedSolids
+{
+    //! Wrapper shape for each unsupported solid, in order of conversion
+    std::vector<UnplacedWrappedSolid const*> shapes;
+
+    //! Number of wrapped solids
+    std::size_t size() const { return shapes.size(); }
+
+    //! Whether every solid was converted natively
+    bool empty() const { return shapes.empty(); }
+
+    // Total number of calls into Geant4 solids
+    std::uint64_t calls() const;
+
+    // Total time spent in Geant4 solids [s]
+    double seconds() const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4vg
@@ -7,14 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "G4VG.hh"
 
-#include <G4GDMLParser.hh>
+#include <G4LogicalVolume.hh>
 #include <VecGeom/management/GeoManager.h>
 #include <VecGeom/volumes/LogicalVolume.h>
 #include <VecGeom/volumes/UnplacedVolume.h>
-#include <geocel/ScopedGeantExceptionHandler.hh>
-#include <gtest/gtest.h>
 
-#include "g4vg_test_config.h"
+#include "G4VGTestBase.hh"
 
 using VGLV = vecgeom::LogicalVolume;
 
@@ -23,83 +21,11 @@ namespace g4vg
 namespace test
 {
 //---------------------------------------------------------------------------//
-
-class G4VGTestBase : public ::testing::Test
-{
-  protected:
-    virtual std::string basename() const = 0;
-
-    void SetUp() override;
-    void TearDown() override;
-
-    G4VPhysicalVolume const* g4world() const { return world_; }
-
-  private:
-    G4VPhysicalVolume* world_{nullptr};
-};
-
-//---------------------------------------------------------------------------//
-/*!
- * Load Geant4 geometry during setup.
- */
-void G4VGTestBase::SetUp()
-{
-    // Guard against loading multiple geometry in the same run
-    static std::string loaded_basename{};
-    std::string this_basename = this->basename();
-
-    if (!loaded_basename.empty())
-    {
-        if (this_basename != loaded_basename)
-        {
-            GTEST_SKIP() << "Cannot run two separate geometries in the same "
-                            "execution: loaded "
-                         << loaded_basename << " but this geometry is "
-                         << this_basename;
-        }
-        // Otherwise the loaded file matches the current one; exit early
-        return;
-    }
-    // Set the basename to a temporary value in case something goes wrong
-    loaded_basename = "<FAILURE>";
-
-    // Construct absolute path to GDML input
-    std::string filename = g4vg_source_dir;
-    filename += "/test/data/";
-    filename += this_basename;
-    filename += ".gdml";
-
-    // Load and strip pointers
-    celeritas::ScopedGeantExceptionHandler scope_exceptions;
-    G4GDMLParser gdml_parser;
-    gdml_parser.SetStripFlag(true);
-    gdml_parser.Read(filename, /* validate_gdml_schema = */ false);
-
-    // Save world volume
-    world_ = gdml_parser.GetWorldVolume();
-    ASSERT_TRUE(world_) << "GDML parser did not return world volume";
-
-    // Save the basename
-    loaded_basename = this_basename;
-}
-
-void G4VGTestBase::TearDown()
-{
-    vecgeom::GeoManager::Instance().Clear();
-}
-
-//---------------------------------------------------------------------------//
-class SolidsTest : public G4VGTestBase
-{
-  protected:
-    std::string basename() const override { return "solids"; }
-};
-
 TEST_F(SolidsTest, default_options)
 {
     auto converted = g4vg::convert(this->g4world());
     ASSERT_TRUE(converted.world);
-    EXPECT_EQ(25, converted.volumes.size());
+    EXPECT_EQ(25, converted.volume_ids.size());
 
     // Set world in VecGeom manager
     auto& vg_manager = vecgeom::GeoManager::Instance();
@@ -107,25 +33,25 @@ TEST_F(SolidsTest, default_options)
     vg_manager.SetWorldAndClose(converted.world);
 
     // Check volumes
-    std::vector<std::string> ordered_g4_names;
-    std::vector<double> ordered_vg_capacities;
+    auto const& ids = converted.ids;
+    ASSERT_EQ(25, ids.num_volumes());
+    std::vector<std::string> ordered_g4_names(ids.num_volumes());
+    std::vector<double> ordered_vg_capacities(ids.num_volumes());
 
-    for (auto&& [g4lv, vgid] : converted.volumes)
+    for (auto&& [g4lv, id] : converted.volume_ids)
     {
-        if (vgid >= ordered_g4_names.size())
-        {
-            ordered_g4_names.resize(vgid + 1);
-            ordered_vg_capacities.resize(ordered_g4_names.size());
-        }
-
         // Save Geant4 name
         ASSERT_TRUE(g4lv);
+        ASSERT_LT(id, ids.num_volumes());
         std::string const& g4name = g4lv->GetName();
-        ordered_g4_names[vgid] = g4name;
+        ordered_g4_names[id] = g4name;
+        ASSERT_LT(id, converted.volume_names.size());
+        EXPECT_EQ(g4name, converted.names[converted.volume_names[id]]);
 
         // Save VecGeom name
-        auto* vglv = vg_manager.FindLogicalVolume(vgid);
+        auto const* vglv = ids.volume(id);
         ASSERT_TRUE(vglv);
+        EXPECT_EQ(id, ids.id(*vglv));
         std::string vgname{vglv->GetName()};
         EXPECT_EQ(0, vgname.find(g4name)) << "Expected Geant4 name '" << g4name
                                           << "' to be at the start of "
@@ -135,25 +61,32 @@ TEST_F(SolidsTest, default_options)
         // Check volume
         auto* vguv = vglv->GetUnplacedVolume();
         ASSERT_TRUE(vguv);
-        ordered_vg_capacities[vgid] = vguv->Capacity();
+        ordered_vg_capacities[id] = vguv->Capacity();
+    }
+
+    // Boolean constituents are numbered after the volumes in the world
+    ASSERT_EQ(29, ids.all_volumes().size());
+    for (auto id = ids.num_volumes(); id != ids.all_volumes().size(); ++id)
+    {
+        EXPECT_EQ(id, ids.id(*ids.volume(id)));
+        EXPECT_EQ("", std::string{ids.volume(id)->GetLabel()});
     }
 
     std::vector<std::string> const expected_g4_names
-        = {"box500",   "cone1",     "para1",      "sphere1",    "parabol1",
-           "trap1",    "trd1",      "trd2",       "trd3",       "trd3_refl",
-           "tube100",  "",          "",           "",           "",
-           "boolean1", "polycone1", "genPocone1", "ellipsoid1", "tetrah1",
-           "orb1",     "polyhedr1", "hype1",      "elltube1",   "ellcone1",
-           "arb8b",    "arb8a",     "xtru1",      "World"};
+        = {"box500",     "cone1",      "para1",     "sphere1",  "parabol1",
+           "trap1",      "trd1",       "trd2",      "trd3",     "trd3_refl",
+           "tube100",    "boolean1",   "polycone1", "genPocone1",
+           "ellipsoid1", "tetrah1",    "orb1",      "polyhedr1", "hype1",
+           "elltube1",   "ellcone1",   "arb8b",     "arb8a",    "xtru1",
+           "World"};
     EXPECT_EQ(expected_g4_names, ordered_g4_names);
 
     std::vector<double> const expected_capacities
         = {1.25e+08,    1.14982e+08, 3.36e+08,    1.13846e+08, 1.13099e+08,
            1.512e+08,   1.4e+08,     1.4e+08,     1.4e+08,     1.4e+08,
-           1.13097e+07, 0,           0,           0,           0,
-           1.16994e+08, 2.72926e+07, 2.08567e+08, 4.41582e+07, 1.06667e+08,
-           2.68083e+08, 2.23013e+08, 7.75367e+07, 1.50796e+08, 4.96372e+06,
-           6.81667e+08, 6.05e+08,    4.505e+06,   1.08e+11};
+           1.13097e+07, 1.16994e+08, 2.72926e+07, 2.08567e+08, 4.41582e+07,
+           1.06667e+08, 2.68083e+08, 2.23013e+08, 7.75367e+07, 1.50796e+08,
+           4.96372e+06, 6.81667e+08, 6.05e+08,    4.505e+06,   1.08e+11};
     ASSERT_EQ(expected_capacities.size(), ordered_vg_capacities.size());
     for (std::size_t i = 0; i != expected_capacities.size(); ++i)
     {
@@ -161,6 +94,70 @@ TEST_F(SolidsTest, default_options)
     }
 }
 
+TEST_F(SolidsTest, deterministic_ids)
+{
+    auto first = g4vg::convert(this->g4world());
+    auto second = g4vg::convert(this->g4world());
+
+    // Inverse map is consistent and has no gaps
+    ASSERT_EQ(first.volume_ids.size(), first.logical_volumes.size());
+    for (auto&& [g4lv, id] : first.volume_ids)
+    {
+        ASSERT_LT(id, first.logical_volumes.size());
+        EXPECT_EQ(g4lv, first.logical_volumes[id]);
+    }
+    EXPECT_EQ("World", first.logical_volumes.back()->GetName());
+
+    // VecGeom IDs are global, but the IDs of both conversions are the same
+    EXPECT_NE(first.world->id(), second.world->id());
+    EXPECT_EQ(first.volume_ids, second.volume_ids);
+    ASSERT_EQ(first.ids.num_placements(), second.ids.num_placements());
+    for (unsigned int id = 0; id != first.ids.num_placements(); ++id)
+    {
+        EXPECT_EQ(std::string{first.ids.placement(id)->GetLabel()},
+                  std::string{second.ids.placement(id)->GetLabel()});
+    }
+    EXPECT_EQ(first.world, first.ids.world());
+}
+
+TEST_F(SolidsTest, no_vecgeom_names)
+{
+    auto named = g4vg::convert(this->g4world());
+
+    Options options;
+    options.vecgeom_names = false;
+    auto converted = g4vg::convert(this->g4world(), options);
+    ASSERT_TRUE(converted.world);
+
+    // Names are only available through the pool
+    for (auto&& [g4lv, id] : converted.volume_ids)
+    {
+        auto const* vglv = converted.ids.volume(id);
+        ASSERT_TRUE(vglv);
+        EXPECT_EQ("", std::string{vglv->GetLabel()});
+        EXPECT_EQ(g4lv->GetName(),
+                  converted.names[converted.volume_names.at(id)]);
+    }
+
+    // Placements are unlabeled too
+    for (unsigned int id = 0; id != converted.ids.num_placements(); ++id)
+    {
+        EXPECT_EQ("", std::string{converted.ids.placement(id)->GetLabel()});
+    }
+
+    // Every Geant4 volume has a unique name
+    EXPECT_EQ(25u, converted.names.size());
+
+    // Other geometries are unchanged
+    for (auto&& [g4lv, id] : named.volume_ids)
+    {
+        auto const* vglv = named.ids.volume(id);
+        ASSERT_TRUE(vglv);
+        EXPECT_EQ(0, std::string{vglv->GetLabel()}.rfind(g4lv->GetName(), 0))
+            << vglv->GetLabel();
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace g4vg
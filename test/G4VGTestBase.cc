@@ -0,0 +1,137 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file G4VGTestBase.cc
+//---------------------------------------------------------------------------//
+#include "G4VGTestBase.hh"
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <G4GDMLParser.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4StateManager.hh>
+#include <G4VExceptionHandler.hh>
+#include <VecGeom/management/GeoManager.h>
+
+#include "g4vg_test_config.h"
+
+namespace g4vg
+{
+namespace test
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Turn Geant4 errors into C++ exceptions while in scope.
+ */
+class ScopedExceptionHandler final : public G4VExceptionHandler
+{
+  public:
+    ScopedExceptionHandler()
+        : previous_{G4StateManager::GetStateManager()->GetExceptionHandler()}
+    {
+        G4StateManager::GetStateManager()->SetExceptionHandler(this);
+    }
+
+    ~ScopedExceptionHandler() final
+    {
+        G4StateManager::GetStateManager()->SetExceptionHandler(previous_);
+    }
+
+    G4bool Notify(char const* origin,
+                  char const* code,
+                  G4ExceptionSeverity severity,
+                  char const* description) final
+    {
+        std::ostringstream msg;
+        msg << origin << " (" << code << "): " << description;
+        if (severity == JustWarning)
+        {
+            std::clog << "Geant4 warning: " << msg.str() << std::endl;
+            return false;
+        }
+        throw std::runtime_error(msg.str());
+    }
+
+  private:
+    G4VExceptionHandler* previous_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load Geant4 geometry during setup.
+ */
+void G4VGTestBase::SetUp()
+{
+    // Guard against loading multiple geometry in the same run
+    static std::string loaded_basename{};
+    static G4VPhysicalVolume* loaded_world{nullptr};
+    static GdmlAuxMap loaded_aux;
+    std::string this_basename = this->basename();
+
+    if (!loaded_basename.empty())
+    {
+        if (this_basename != loaded_basename)
+        {
+            GTEST_SKIP() << "Cannot run two separate geometries in the same "
+                            "execution: loaded "
+                         << loaded_basename << " but this geometry is "
+                         << this_basename;
+        }
+        // Otherwise the loaded file matches the current one; exit early
+        world_ = loaded_world;
+        gdml_aux_ = &loaded_aux;
+        return;
+    }
+    // Set the basename to a temporary value in case something goes wrong
+    loaded_basename = "<FAILURE>";
+
+    // Construct absolute path to GDML input
+    std::string filename = g4vg_source_dir;
+    filename += "/test/data/";
+    filename += this_basename;
+    filename += ".gdml";
+
+    // Load and strip pointers
+    ScopedExceptionHandler scope_exceptions;
+    G4GDMLParser gdml_parser;
+    gdml_parser.SetStripFlag(true);
+    gdml_parser.Read(filename, /* validate_gdml_schema = */ false);
+
+    // Save world volume
+    world_ = gdml_parser.GetWorldVolume();
+    ASSERT_TRUE(world_) << "GDML parser did not return world volume";
+
+    // Copy the auxiliary tags, which are owned by the parser
+    loaded_aux = *gdml_parser.GetAuxMap();
+    gdml_aux_ = &loaded_aux;
+
+    // Save the basename
+    loaded_basename = this_basename;
+    loaded_world = world_;
+}
+
+void G4VGTestBase::TearDown()
+{
+    vecgeom::GeoManager::Instance().Clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find a Geant4 logical volume by name.
+ */
+G4LogicalVolume* SolidsTest::find_lv(std::string const& name) const
+{
+    return G4LogicalVolumeStore::GetInstance()->GetVolume(name, false);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file G4VGTestBase.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include "g4vg/VolumeAttributes.hh"
+
+class G4LogicalVolume;
+class G4VPhysicalVolume;
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Load a Geant4 geometry from a GDML file in the test data directory.
+ *
+ * Only one geometry can be loaded per test executable.
+ */
+class G4VGTestBase : public ::testing::Test
+{
+  protected:
+    virtual std::string basename() const = 0;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    G4VPhysicalVolume const* g4world() const { return world_; }
+
+    //! Auxiliary tags of the volumes read from the GDML file
+    GdmlAuxMap const& gdml_aux() const { return *gdml_aux_; }
+
+  private:
+    G4VPhysicalVolume* world_{nullptr};
+    GdmlAuxMap const* gdml_aux_{nullptr};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load the geometry with one volume for each supported solid type.
+ */
+class SolidsTest : public G4VGTestBase
+{
+  protected:
+    std::string basename() const override { return "solids"; }
+
+    // Find a Geant4 logical volume by name
+    G4LogicalVolume* find_lv(std::string const& name) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Alignment.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/Alignment.hh"
+
+#include <stdexcept>
+#include <vector>
+#include <G4PhysicalVolumeStore.hh>
+#include <G4VPhysicalVolume.hh>
+
+#include "g4vg/Transformer.hh"
+
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class AlignmentTest : public SolidsTest
+{
+  protected:
+    Options options() const
+    {
+        Options result;
+        result.navigation_tables = true;
+        result.placement_table = true;
+        result.compact_transforms = true;
+        result.touchable_volumes = {this->placement()->GetLogicalVolume()};
+        return result;
+    }
+
+    G4VPhysicalVolume* placement() const
+    {
+        return G4PhysicalVolumeStore::GetInstance()->GetVolume("reflNormal",
+                                                               false);
+    }
+
+    // Check that the transform-dependent tables match a fresh conversion
+    static void
+    expect_same_transforms(Converted const& expected, Converted const& actual)
+    {
+        auto expect_near = [](std::vector<double> const& e,
+                              std::vector<double> const& a) {
+            ASSERT_EQ(e.size(), a.size());
+            for (std::size_t i = 0; i != e.size(); ++i)
+            {
+                EXPECT_NEAR(e[i], a[i], 1e-9) << "at index " << i;
+            }
+        };
+
+        expect_near(expected.navigation.daughter_transform,
+                    actual.navigation.daughter_transform);
+        for (int i = 0; i < 3; ++i)
+        {
+            expect_near(expected.placements.translation[i],
+                        actual.placements.translation[i]);
+            expect_near(expected.placements.bbox_lower[i],
+                        actual.placements.bbox_lower[i]);
+            expect_near(expected.placements.bbox_upper[i],
+                        actual.placements.bbox_upper[i]);
+        }
+        for (int i = 0; i < 9; ++i)
+        {
+            expect_near(expected.placements.rotation[i],
+                        actual.placements.rotation[i]);
+        }
+        expect_near(expected.touchables.transform,
+                    actual.touchables.transform);
+
+        ASSERT_EQ(expected.placements.size(), actual.placements.size());
+        for (unsigned int row = 0; row != actual.placements.size(); ++row)
+        {
+            auto e = expected.transforms.translation(
+                expected.placements.placed[row]);
+            auto a = actual.transforms.translation(
+                actual.placements.placed[row]);
+            for (int i = 0; i < 3; ++i)
+            {
+                EXPECT_NEAR(e[i], a[i], 1e-9) << "at row " << row;
+            }
+        }
+    }
+};
+
+TEST_F(AlignmentTest, alignment)
+{
+    G4VPhysicalVolume* pv = this->placement();
+    ASSERT_TRUE(pv);
+    auto const nominal = pv->GetTranslation();
+
+    auto const original = g4vg::convert(this->g4world(), this->options());
+    auto converted = g4vg::convert(this->g4world(), this->options());
+    ASSERT_FALSE(converted.touchables.empty());
+
+    // Convert with the Geant4 volume moved along its local x axis
+    G4Translate3D const delta{10, 0, 0};
+    pv->SetTranslation((object_transform(*pv) * delta).getTranslation());
+    auto const moved = g4vg::convert(this->g4world(), this->options());
+    pv->SetTranslation(nominal);
+
+    // Correcting the nominal geometry gives the same tables
+    auto result = apply_alignment(&converted, {{pv, delta}});
+    EXPECT_EQ(1, result.placements);
+    EXPECT_EQ(1, result.mothers);
+    EXPECT_EQ(1, result.touchables);
+    expect_same_transforms(moved, converted);
+
+    // Resynchronizing with the unmodified Geant4 volume undoes it
+    result = update_placements(&converted, {pv});
+    EXPECT_EQ(1, result.placements);
+    expect_same_transforms(original, converted);
+
+    EXPECT_THROW(update_placements(&converted, {this->g4world()}),
+                 std::invalid_argument);
+    EXPECT_THROW(update_placements(&converted, {nullptr}),
+                 std::invalid_argument);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
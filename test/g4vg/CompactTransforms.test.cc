@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/CompactTransforms.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/CompactTransforms.hh"
+
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class CompactTransformsTest : public SolidsTest
+{
+  protected:
+    void check_transforms(Converted const& converted, double tol) const
+    {
+        auto const& transforms = converted.transforms;
+        auto const& ids = converted.ids;
+        ASSERT_EQ(ids.num_placements(), transforms.size());
+        EXPECT_TRUE(transforms.is_identity(ids.id(*converted.world)));
+
+        using VGVector = vecgeom::Vector3D<vecgeom::Precision>;
+        VGVector const pos{123.4, -567.8, 9.1};
+        auto const* world_lv = converted.world->GetLogicalVolume();
+        for (auto const* pv : world_lv->GetDaughters())
+        {
+            auto const id = ids.id(*pv);
+            ASSERT_LT(id, transforms.size());
+            VGVector expected = pv->GetTransformation()->Transform(pos);
+            auto actual = transforms.to_local(id, {pos[0], pos[1], pos[2]});
+            EXPECT_NEAR(expected[0], actual[0], tol);
+            EXPECT_NEAR(expected[1], actual[1], tol);
+            EXPECT_NEAR(expected[2], actual[2], tol);
+            EXPECT_EQ(pv->GetTransformation()->HasRotation(),
+                      transforms.rotation_id(id)
+                          != CompactTransforms::no_rotation);
+        }
+    }
+};
+
+TEST_F(CompactTransformsTest, double_translations)
+{
+    Options options;
+    options.compact_transforms = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+    auto const& transforms = converted.transforms;
+
+    EXPECT_FALSE(transforms.float_translations());
+    EXPECT_EQ(0, transforms.max_translation_error());
+    // Only a few distinct rotations are used
+    EXPECT_GT(transforms.num_rotations(), 0u);
+    EXPECT_LT(transforms.num_rotations(), 5u);
+    // Much smaller than a full 3x4 double matrix per placement
+    EXPECT_LT(transforms.memory_bytes(),
+              transforms.size() * 12 * sizeof(double) / 2);
+
+    this->check_transforms(converted, 1e-9);
+}
+
+TEST_F(CompactTransformsTest, float_translations)
+{
+    Options options;
+    options.compact_transforms = true;
+    options.transform_options.float_translations = true;
+    options.transform_options.max_translation_error = 1e-3;
+    auto converted = g4vg::convert(this->g4world(), options);
+    auto const& transforms = converted.transforms;
+
+    EXPECT_TRUE(transforms.float_translations());
+    EXPECT_LE(transforms.max_translation_error(), 1e-3);
+    this->check_transforms(converted, 2e-3);
+}
+
+TEST_F(CompactTransformsTest, disabled)
+{
+    auto converted = g4vg::convert(this->g4world());
+    EXPECT_TRUE(converted.transforms.empty());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,186 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/DaughterOrder.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/DaughterOrder.hh"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <G4LogicalVolume.hh>
+#include <G4Navigator.hh>
+#include <G4VPhysicalVolume.hh>
+#include <VecGeom/management/GeoManager.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+#include "g4vg/ExternalNavigation.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(NavigationProfileTest, io)
+{
+    std::istringstream is{R"(
+# name copy count
+Tracker 0 10
+CaloCell 12 104553
+
+Tracker 0 5
+)"};
+    auto profile = NavigationProfile::from_stream(is);
+    EXPECT_EQ(15u, profile.count("Tracker", 0));
+    EXPECT_EQ(104553u, profile.count("CaloCell", 12));
+    EXPECT_EQ(0u, profile.count("CaloCell", 0));
+
+    std::ostringstream os;
+    profile.write(os);
+    std::istringstream reread{os.str()};
+    auto const reread_profile = NavigationProfile::from_stream(reread);
+    EXPECT_EQ(profile.counts(), reread_profile.counts());
+
+    std::istringstream bad{"Tracker zero 10\n"};
+    EXPECT_THROW(NavigationProfile::from_stream(bad), std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+TEST(MortonTest, keys)
+{
+    std::vector<std::array<double, 3>> const points{
+        {10, 10, 10}, {0, 0, 0}, {0, 10, 0}, {10, 0, 0}, {0, 0, 10}};
+    auto const keys = morton_keys(points);
+    ASSERT_EQ(points.size(), keys.size());
+    EXPECT_EQ(0u, keys[1]);
+    EXPECT_LT(keys[1], keys[3]);
+    EXPECT_LT(keys[3], keys[2]);
+    EXPECT_LT(keys[2], keys[4]);
+    EXPECT_LT(keys[4], keys[0]);
+    EXPECT_TRUE(morton_keys({}).empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, morton)
+{
+    Options options;
+    options.daughter_order = DaughterOrder::morton;
+    auto converted = g4vg::convert(this->g4world(), options);
+    ASSERT_TRUE(converted.world);
+    ASSERT_FALSE(converted.daughter_slots.empty());
+
+    // Daughters are a permutation of the Geant4 daughters
+    G4LogicalVolume const* g4_world_lv = this->g4world()->GetLogicalVolume();
+    auto const& vg_daughters
+        = converted.world->GetLogicalVolume()->GetDaughters();
+    ASSERT_EQ(g4_world_lv->GetNoDaughters(), vg_daughters.size());
+    std::vector<unsigned int> slots;
+    for (std::size_t i = 0; i != vg_daughters.size(); ++i)
+    {
+        auto const* vgpv = vg_daughters[i];
+        auto const pv_id = converted.ids.id(*vgpv);
+        ASSERT_LT(pv_id, converted.daughter_slots.size());
+        auto slot = converted.daughter_slots[pv_id];
+        slots.push_back(slot);
+        ASSERT_LT(slot, g4_world_lv->GetNoDaughters());
+        auto const lv_id = converted.ids.id(*vgpv->GetLogicalVolume());
+        EXPECT_EQ(g4_world_lv->GetDaughter(slot)->GetLogicalVolume(),
+                  converted.logical_volumes[lv_id]);
+    }
+    EXPECT_FALSE(std::is_sorted(slots.begin(), slots.end()));
+    std::sort(slots.begin(), slots.end());
+    for (std::size_t i = 0; i != slots.size(); ++i)
+    {
+        EXPECT_EQ(i, slots[i]);
+    }
+
+    // Navigation is unaffected by the order
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    vg_manager.RegisterPlacedVolume(converted.world);
+    vg_manager.SetWorldAndClose(converted.world);
+
+    auto* world = const_cast<G4VPhysicalVolume*>(this->g4world());
+    G4Navigator g4_nav;
+    g4_nav.SetWorldVolume(world);
+    G4Navigator vg_nav;
+    vg_nav.SetWorldVolume(world);
+    ExternalNavigation ext_nav{converted};
+    vg_nav.SetExternalNavigation(ext_nav.Clone());
+    for (double y : {-1249.9, 0.1, 1250.1})
+    {
+        for (double x = -5249.9; x <= 3750; x += 250)
+        {
+            G4ThreeVector const pos{x, y, 0.01};
+            auto* expected = g4_nav.LocateGlobalPointAndSetup(pos);
+            auto* actual = vg_nav.LocateGlobalPointAndSetup(pos);
+            ASSERT_TRUE(expected && actual);
+            EXPECT_EQ(expected->GetName(), actual->GetName())
+                << "at " << x << ", " << y;
+        }
+    }
+}
+
+TEST_F(SolidsTest, profile)
+{
+    G4LogicalVolume const* g4_world_lv = this->g4world()->GetLogicalVolume();
+    auto const num_daughters = g4_world_lv->GetNoDaughters();
+    ASSERT_GT(num_daughters, 6u);
+
+    NavigationProfile profile;
+    auto add_count = [&](std::size_t i, unsigned long long count) {
+        auto const* pv = g4_world_lv->GetDaughter(i);
+        profile.add(pv->GetName(), pv->GetCopyNo(), count);
+    };
+    add_count(5, 100);
+    add_count(2, 50);
+    add_count(num_daughters - 1, 1);
+
+    Options options;
+    options.daughter_order = DaughterOrder::profile;
+    EXPECT_THROW(g4vg::convert(this->g4world(), options),
+                 std::invalid_argument);
+    options.profile = &profile;
+    auto converted = g4vg::convert(this->g4world(), options);
+
+    // Most frequently entered first, then Geant4 order
+    std::vector<unsigned long long> counts;
+    for (std::size_t i = 0; i != num_daughters; ++i)
+    {
+        auto const* pv = g4_world_lv->GetDaughter(i);
+        counts.push_back(profile.count(pv->GetName(), pv->GetCopyNo()));
+    }
+    std::vector<unsigned int> expected(num_daughters);
+    std::iota(expected.begin(), expected.end(), 0u);
+    std::stable_sort(
+        expected.begin(), expected.end(), [&counts](auto a, auto b) {
+            return counts[a] > counts[b];
+        });
+    EXPECT_EQ(5u, expected.front());
+
+    auto const& vg_daughters
+        = converted.world->GetLogicalVolume()->GetDaughters();
+    std::vector<unsigned int> actual;
+    for (auto const* vgpv : vg_daughters)
+    {
+        auto const pv_id = converted.ids.id(*vgpv);
+        actual.push_back(converted.daughter_slots.at(pv_id));
+    }
+    EXPECT_EQ(expected, actual);
+}
+
+TEST_F(SolidsTest, geant4)
+{
+    auto converted = g4vg::convert(this->g4world());
+    EXPECT_TRUE(converted.daughter_slots.empty());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
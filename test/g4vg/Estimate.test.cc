@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Estimate.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/Estimate.hh"
+
+#include <G4Box.hh>
+#include <G4LogicalVolume.hh>
+#include <G4MultiUnion.hh>
+#include <G4Transform3D.hh>
+#include <G4VPhysicalVolume.hh>
+#include <VecGeom/management/GeoManager.h>
+
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, counts)
+{
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    auto const num_lv_before = vg_manager.GetRegisteredVolumesCount();
+    auto const est = g4vg::estimate(this->g4world(), {});
+
+    // Nothing was created in VecGeom
+    EXPECT_EQ(num_lv_before, vg_manager.GetRegisteredVolumesCount());
+
+    // 25 volumes plus two helpers for each of the two nested booleans
+    EXPECT_EQ(29, est.logical_volumes);
+    EXPECT_EQ(1 + 24 + 4, est.placed_volumes);
+    EXPECT_EQ(25.0, est.touchables);
+    EXPECT_GT(est.vecgeom_bytes, 0);
+    EXPECT_GT(est.table_bytes, 0);
+    EXPECT_GT(est.seconds, 0);
+
+    // Counts match the VecGeom objects created by an actual conversion
+    auto const num_pv_before = vg_manager.GetPlacedVolumesCount();
+    auto converted = g4vg::convert(this->g4world());
+    EXPECT_EQ(est.logical_volumes,
+              vg_manager.GetRegisteredVolumesCount() - num_lv_before);
+    EXPECT_EQ(est.placed_volumes,
+              vg_manager.GetPlacedVolumesCount() - num_pv_before);
+}
+
+TEST_F(SolidsTest, multi_union_counts)
+{
+    // Temporarily replace a box with a union of three nodes
+    G4Box box{"mu_box", 10, 10, 10};
+    G4MultiUnion multi{"mu"};
+    multi.AddNode(box, G4Transform3D{});
+    multi.AddNode(box, G4Translate3D{15, 0, 0});
+    multi.AddNode(box, G4Translate3D{0, 15, 0});
+    multi.Voxelize();
+    auto* lv = this->find_lv("box500");
+    ASSERT_TRUE(lv);
+    auto* orig_solid = lv->GetSolid();
+    lv->SetSolid(&multi);
+
+    // Each node is placed in a helper volume
+    auto const est = g4vg::estimate(this->g4world(), {});
+    EXPECT_EQ(29 + 3, est.logical_volumes);
+    EXPECT_EQ(1 + 24 + 4 + 3, est.placed_volumes);
+
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    auto const num_lv_before = vg_manager.GetRegisteredVolumesCount();
+    auto const num_pv_before = vg_manager.GetPlacedVolumesCount();
+    {
+        auto converted = g4vg::convert(this->g4world());
+        EXPECT_EQ(est.logical_volumes,
+                  vg_manager.GetRegisteredVolumesCount() - num_lv_before);
+        EXPECT_EQ(est.placed_volumes,
+                  vg_manager.GetPlacedVolumesCount() - num_pv_before);
+    }
+    lv->SetSolid(orig_solid);
+}
+
+TEST_F(SolidsTest, options)
+{
+    auto const base = g4vg::estimate(this->g4world(), {});
+
+    Options options;
+    options.linear_tree = true;
+    options.placement_table = true;
+    options.touchable_volumes = {this->find_lv("box500")};
+    auto const est = g4vg::estimate(this->g4world(), options);
+
+    // Only table costs change
+    EXPECT_EQ(base.logical_volumes, est.logical_volumes);
+    EXPECT_EQ(base.vecgeom_bytes, est.vecgeom_bytes);
+    EXPECT_GT(est.table_bytes, base.table_bytes);
+    EXPECT_GT(est.seconds, base.seconds);
+    EXPECT_EQ(est.vecgeom_bytes + est.table_bytes, est.bytes());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,192 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/ExternalNavigation.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/ExternalNavigation.hh"
+
+#include <string>
+#include <vector>
+#include <G4LogicalVolume.hh>
+#include <G4Navigator.hh>
+#include <G4ReflectedSolid.hh>
+#include <G4VPhysicalVolume.hh>
+#include <VecGeom/management/GeoManager.h>
+
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Volumes entered, step lengths, and safeties along a straight track
+struct Track
+{
+    std::vector<std::string> volumes;
+    std::vector<double> steps;
+    std::vector<double> safeties;
+};
+
+Track track(G4Navigator* nav, G4ThreeVector pos, G4ThreeVector const& dir)
+{
+    Track result;
+    auto* pv = nav->LocateGlobalPointAndSetup(pos, &dir, false, false);
+    for (int i = 0; pv && i != 16; ++i)
+    {
+        result.volumes.push_back(pv->GetName());
+        double safety{-1};
+        double const step = nav->ComputeStep(pos, dir, 1e5, safety);
+        result.steps.push_back(step);
+        result.safeties.push_back(safety);
+        pos += step * dir;
+        nav->SetGeometricallyLimitedStep();
+        pv = nav->LocateGlobalPointAndSetup(pos, &dir, true);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, compare_navigation)
+{
+    auto converted = g4vg::convert(this->g4world());
+    ASSERT_TRUE(converted.world);
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    vg_manager.RegisterPlacedVolume(converted.world);
+    vg_manager.SetWorldAndClose(converted.world);
+
+    auto* world = const_cast<G4VPhysicalVolume*>(this->g4world());
+    G4Navigator g4_nav;
+    g4_nav.SetWorldVolume(world);
+    G4Navigator vg_nav;
+    vg_nav.SetWorldVolume(world);
+    ExternalNavigation ext_nav{converted};
+    vg_nav.SetExternalNavigation(ext_nav.Clone());
+
+    // Scan a grid through the centers of the daughter volumes, offset to
+    // avoid starting exactly on a surface
+    G4ThreeVector const dir{1, 0, 0};
+    int num_points{0};
+    for (double y : {-1249.9, 0.1, 1250.1})
+    {
+        for (double x = -5249.9; x <= 3750; x += 125)
+        {
+            G4ThreeVector const pos{x, y, 0.01};
+            auto* expected = g4_nav.LocateGlobalPointAndSetup(pos);
+            auto* actual = vg_nav.LocateGlobalPointAndSetup(pos);
+            ASSERT_TRUE(expected);
+            ASSERT_TRUE(actual);
+            EXPECT_EQ(expected->GetName(), actual->GetName())
+                << "at " << x << ", " << y;
+
+            double g4_safety{-1};
+            double vg_safety{-1};
+            double g4_step = g4_nav.ComputeStep(pos, dir, 1e4, g4_safety);
+            double vg_step = vg_nav.ComputeStep(pos, dir, 1e4, vg_safety);
+            EXPECT_NEAR(g4_step, vg_step, 1e-6) << "at " << x << ", " << y;
+            // Safety is a conservative estimate that may differ between
+            // implementations but is never more than the true step
+            EXPECT_GE(vg_safety, 0);
+            EXPECT_LE(vg_safety, vg_step + 1e-6);
+            ++num_points;
+        }
+    }
+    EXPECT_EQ(3 * 73, num_points);
+}
+
+TEST_F(SolidsTest, reflected_navigation)
+{
+    auto converted = g4vg::convert(this->g4world());
+    ASSERT_TRUE(converted.world);
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    vg_manager.RegisterPlacedVolume(converted.world);
+    vg_manager.SetWorldAndClose(converted.world);
+
+    auto* world = const_cast<G4VPhysicalVolume*>(this->g4world());
+    G4Navigator g4_nav;
+    g4_nav.SetWorldVolume(world);
+    G4Navigator vg_nav;
+    vg_nav.SetWorldVolume(world);
+    ExternalNavigation ext_nav{converted};
+    vg_nav.SetExternalNavigation(ext_nav.Clone());
+
+    // Track through the overlapping reflected trd3 placements, whose solids
+    // are narrower at one end, along each axis
+    int num_reflected{0};
+    for (G4ThreeVector const dir : {G4ThreeVector{1, 0, 0},
+                                    G4ThreeVector{0, 1, 0},
+                                    G4ThreeVector{0, 0, 1},
+                                    G4ThreeVector{0, 0, -1}})
+    {
+        for (double z : {-300.1, -100.1, 0.1, 200.1, 400.1})
+        {
+            for (double x : {-5300.1, -5200.1, -5100.1, -5000.1, -4900.1})
+            {
+                // Start just inside the world, behind the point
+                G4ThreeVector start{x, -1250.1, z};
+                G4ThreeVector const world_half{5990, 2990, 740};
+                for (int ax = 0; ax < 3; ++ax)
+                {
+                    if (dir[ax] != 0)
+                    {
+                        start[ax] = -dir[ax] * world_half[ax];
+                    }
+                }
+                auto const expected = track(&g4_nav, start, dir);
+                auto const actual = track(&vg_nav, start, dir);
+                EXPECT_EQ(expected.volumes, actual.volumes)
+                    << "from " << start << " along " << dir;
+                ASSERT_EQ(expected.steps.size(), actual.steps.size());
+                for (std::size_t i = 0; i != expected.steps.size(); ++i)
+                {
+                    EXPECT_NEAR(expected.steps[i], actual.steps[i], 1e-6)
+                        << "step " << i << " from " << start << " along "
+                        << dir;
+                    if (expected.safeties[i] == 0)
+                    {
+                        // Just exited a daughter, which is blocked
+                        EXPECT_EQ(0, actual.safeties[i])
+                            << "step " << i << " from " << start
+                            << " along " << dir;
+                    }
+                }
+                for (auto const& name : expected.volumes)
+                {
+                    num_reflected += (name.rfind("reflected", 0) == 0);
+                }
+            }
+        }
+    }
+    EXPECT_LT(0, num_reflected);
+
+    // Inside uses the converted shape in the frame of the reflected solid
+    G4LogicalVolume const* world_lv = world->GetLogicalVolume();
+    int num_solids{0};
+    for (std::size_t i = 0; i != world_lv->GetNoDaughters(); ++i)
+    {
+        auto const* solid
+            = world_lv->GetDaughter(i)->GetLogicalVolume()->GetSolid();
+        if (!dynamic_cast<G4ReflectedSolid const*>(solid))
+        {
+            continue;
+        }
+        ++num_solids;
+        for (double z = -450; z <= 450; z += 100)
+        {
+            for (double x = -190; x <= 190; x += 20)
+            {
+                G4ThreeVector const pos{x, 0.5 * x, z};
+                EXPECT_EQ(solid->Inside(pos),
+                          ext_nav.Inside(solid, pos, {0, 0, 1}))
+                    << solid->GetName() << " at " << pos;
+            }
+        }
+    }
+    EXPECT_LT(0, num_solids);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
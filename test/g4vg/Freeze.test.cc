@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/Freeze.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/Freeze.hh"
+
+#include <string>
+#include <vector>
+
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, freeze)
+{
+    Options options;
+    options.navigation_tables = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+
+    // Save copies of the tables
+    auto const volumes = converted.volume_ids;
+    auto const volume_material = converted.materials.volume_material;
+    auto const daughter_offsets = converted.navigation.daughter_offsets;
+    std::vector<std::string> names;
+    for (unsigned int id = 0; id != converted.names.size(); ++id)
+    {
+        names.emplace_back(converted.names[id]);
+    }
+
+    auto result = freeze(&converted);
+    EXPECT_EQ(memory_bytes(converted), result.bytes_after);
+    EXPECT_GT(result.bytes_before, result.bytes_after);
+    EXPECT_EQ(result.bytes_before - result.bytes_after, result.reclaimed());
+
+    // Tables are unchanged
+    EXPECT_EQ(volumes, converted.volume_ids);
+    EXPECT_EQ(volume_material, converted.materials.volume_material);
+    EXPECT_EQ(daughter_offsets, converted.navigation.daughter_offsets);
+    ASSERT_EQ(names.size(), converted.names.size());
+    for (unsigned int id = 0; id != converted.names.size(); ++id)
+    {
+        EXPECT_EQ(names[id], converted.names[id]);
+        EXPECT_EQ(id, converted.names.find(names[id]));
+    }
+
+    // Freezing again has nothing to reclaim
+    EXPECT_EQ(0u, freeze(&converted).reclaimed());
+
+    // Drop the volume map
+    FreezeOptions freeze_options;
+    freeze_options.keep_volume_map = false;
+    result = freeze(&converted, freeze_options);
+    EXPECT_GT(result.reclaimed(), 0u);
+    EXPECT_TRUE(converted.volume_ids.empty());
+    EXPECT_EQ(names.size(), converted.names.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,110 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GdmlReader.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/GdmlReader.hh"
+
+#include <map>
+#include <G4LogicalVolume.hh>
+#include <VecGeom/management/GeoManager.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "G4VGTestBase.hh"
+#include "g4vg_test_config.h"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, read_gdml)
+{
+    if (!has_gdml_reader())
+    {
+        GTEST_SKIP() << "VecGeom GDML support is disabled";
+    }
+
+    // IDs, capacities, and daughter counts from the Geant4 path
+    struct Expected
+    {
+        unsigned int id;
+        double capacity;
+        std::size_t num_daughters;
+    };
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    std::map<std::string, Expected> expected;
+    {
+        auto converted = g4vg::convert(this->g4world());
+        for (auto&& [g4lv, id] : converted.volume_ids)
+        {
+            auto const* vglv = converted.ids.volume(id);
+            expected[g4lv->GetName()]
+                = {id,
+                   vglv->GetUnplacedVolume()->Capacity(),
+                   vglv->GetDaughters().size()};
+        }
+        vg_manager.Clear();
+    }
+
+    Options options;
+    options.linear_tree = true;
+    std::string filename = g4vg_source_dir;
+    filename += "/test/data/solids.gdml";
+    auto converted = read_gdml(filename, options);
+    ASSERT_TRUE(converted.world);
+    EXPECT_TRUE(converted.volume_ids.empty());
+    EXPECT_TRUE(converted.logical_volumes.empty());
+    EXPECT_EQ(1 + expected.at("World").num_daughters, converted.tree.size());
+
+    // Frontend objects are owned by the result and all numbered
+    auto const& ids = converted.ids;
+    EXPECT_FALSE(converted.store.empty());
+    EXPECT_EQ(converted.store.volumes().size(), ids.all_volumes().size());
+    EXPECT_EQ(converted.store.placed().size(), ids.all_placements().size());
+    EXPECT_EQ(converted.world, ids.world());
+
+    // Every Geant4 volume has a VecGeom counterpart with the same ID and
+    // capacity
+    ASSERT_EQ(ids.num_volumes(), converted.volume_names.size());
+    std::size_t num_matched = 0;
+    for (unsigned int id = 0; id != ids.num_volumes(); ++id)
+    {
+        auto const* vglv = ids.volume(id);
+        std::string name{converted.names[converted.volume_names[id]]};
+        auto iter = expected.find(name);
+        if (iter == expected.end())
+        {
+            ADD_FAILURE() << "unexpected volume " << name;
+            continue;
+        }
+        EXPECT_EQ(iter->second.id, id) << name;
+        EXPECT_NEAR(iter->second.capacity,
+                    vglv->GetUnplacedVolume()->Capacity(),
+                    1e-6 * iter->second.capacity)
+            << name;
+        EXPECT_EQ(iter->second.num_daughters, vglv->GetDaughters().size())
+            << name;
+        ++num_matched;
+    }
+    EXPECT_EQ(expected.size(), num_matched);
+}
+
+TEST_F(SolidsTest, read_gdml_rejects_geant4_options)
+{
+    Options options;
+    options.report_unreachable = true;
+    EXPECT_THROW(read_gdml("solids.gdml", options), std::invalid_argument);
+
+    // Daughters are ordered as the converter places them
+    options.report_unreachable = false;
+    options.daughter_order = DaughterOrder::morton;
+    EXPECT_THROW(read_gdml("solids.gdml", options), std::invalid_argument);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
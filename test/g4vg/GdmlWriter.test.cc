@@ -0,0 +1,180 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GdmlWriter.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/GdmlWriter.hh"
+
+#include <fstream>
+#include <sstream>
+#include <G4Box.hh>
+#include <G4GDMLParser.hh>
+#include <G4LogicalVolume.hh>
+#include <G4ReflectedSolid.hh>
+#include <G4UnionSolid.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Count the non-overlapping occurrences of a substring
+std::size_t count(std::string const& s, std::string const& sub)
+{
+    std::size_t result = 0;
+    for (auto pos = s.find(sub); pos != std::string::npos;
+         pos = s.find(sub, pos + sub.size()))
+    {
+        ++result;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Whether a placement is reflected (Geant4 reflects the volume's solid)
+bool is_reflected(G4VPhysicalVolume const& pv)
+{
+    return dynamic_cast<G4ReflectedSolid const*>(
+               pv.GetLogicalVolume()->GetSolid())
+           != nullptr;
+}
+
+//---------------------------------------------------------------------------//
+//! Compare a volume read back from GDML with the original, recursively
+void expect_same_volume(G4LogicalVolume const& expected,
+                        G4LogicalVolume const& actual)
+{
+    SCOPED_TRACE(expected.GetName());
+
+    // Some capacities are Monte Carlo estimates
+    double const capacity = expected.GetSolid()->GetCubicVolume();
+    EXPECT_NEAR(
+        capacity, actual.GetSolid()->GetCubicVolume(), 0.01 * capacity);
+
+    ASSERT_EQ(expected.GetNoDaughters(), actual.GetNoDaughters());
+    for (std::size_t i = 0; i != expected.GetNoDaughters(); ++i)
+    {
+        auto const* e = expected.GetDaughter(i);
+        auto const* a = actual.GetDaughter(i);
+        EXPECT_EQ(e->GetName(), a->GetName());
+        EXPECT_EQ(e->GetCopyNo(), a->GetCopyNo());
+        EXPECT_NEAR(0, (e->GetTranslation() - a->GetTranslation()).mag(), 1e-6)
+            << e->GetName();
+        auto const erot = e->GetObjectRotationValue();
+        auto const arot = a->GetObjectRotationValue();
+        EXPECT_NEAR(0, (erot.colX() - arot.colX()).mag(), 1e-9);
+        EXPECT_NEAR(0, (erot.colY() - arot.colY()).mag(), 1e-9);
+        EXPECT_NEAR(0, (erot.colZ() - arot.colZ()).mag(), 1e-9);
+        EXPECT_EQ(is_reflected(*e), is_reflected(*a)) << e->GetName();
+        expect_same_volume(*e->GetLogicalVolume(), *a->GetLogicalVolume());
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, write_gdml)
+{
+    auto converted = g4vg::convert(this->g4world());
+
+    std::ostringstream os;
+    write_gdml(converted, os);
+    std::string const gdml = os.str();
+
+    // Sections are written in order
+    auto const define = gdml.find("<define>");
+    auto const materials = gdml.find("<materials>");
+    auto const solids = gdml.find("<solids>");
+    auto const structure = gdml.find("<structure>");
+    auto const setup = gdml.find("<setup ");
+    EXPECT_LT(define, materials);
+    EXPECT_LT(materials, solids);
+    EXPECT_LT(solids, structure);
+    EXPECT_LT(structure, setup);
+    EXPECT_NE(std::string::npos, gdml.find("<world ref=\"World"));
+    EXPECT_EQ("</gdml>\n", gdml.substr(gdml.size() - 8));
+
+    // Every real volume and placement is written exactly once
+    EXPECT_EQ(converted.volume_ids.size(), count(gdml, "<volume "));
+    EXPECT_EQ(converted.volume_ids.size() - 1, count(gdml, "<physvol "));
+    EXPECT_EQ(count(gdml, "<physvol "), count(gdml, "<volumeref "));
+    EXPECT_EQ(2, count(gdml, "<material "));
+    EXPECT_NE(std::string::npos, gdml.find("<material name=\"Water\""));
+    EXPECT_EQ(count(gdml, "<volume "), count(gdml, "<materialref "));
+
+    // Shared transforms are defined once and referenced
+    EXPECT_LE(count(gdml, "<rotation "), count(gdml, "<rotationref "));
+    EXPECT_LE(count(gdml, "<position "), count(gdml, "<positionref "));
+
+    // Full lengths are written in ID order (box500 is the first volume)
+    EXPECT_NE(std::string::npos,
+              gdml.find("<box name=\"S0\" x=\"500\" y=\"500\" z=\"500\""));
+
+    // Every shape is exported exactly
+    EXPECT_EQ(0, count(gdml, "bounding box"));
+    EXPECT_EQ(1, count(gdml, "<polyhedra "));
+    EXPECT_EQ(1, count(gdml, "<genericPolycone "));
+    EXPECT_EQ(1, count(gdml, "<xtru "));
+    EXPECT_EQ(1, count(gdml, "<tet "));
+    EXPECT_EQ(2, count(gdml, "<arb8 "));
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, write_gdml_reflected_constituent)
+{
+    auto const base = [this] {
+        std::ostringstream os;
+        write_gdml(g4vg::convert(this->g4world()), os);
+        return os.str();
+    }();
+
+    // Temporarily replace a box with a union containing a reflected box
+    G4Box box{"refl_box", 10, 20, 30};
+    G4ReflectedSolid reflected{
+        "refl_box_refl", &box, G4Translate3D{0, 0, 50} * G4ReflectZ3D{}};
+    G4UnionSolid both{"refl_union", &box, &reflected};
+    auto* lv = this->find_lv("box500");
+    ASSERT_TRUE(lv);
+    auto* orig_solid = lv->GetSolid();
+    lv->SetSolid(&both);
+    std::ostringstream os;
+    write_gdml(g4vg::convert(this->g4world()), os);
+    lv->SetSolid(orig_solid);
+    std::string const gdml = os.str();
+
+    // GDML booleans can't be reflected: a reflected solid is written instead
+    EXPECT_EQ(1, count(gdml, "<reflectedSolid "));
+    EXPECT_EQ(count(base, "<scaleref "), count(gdml, "<scaleref "));
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, write_gdml_roundtrip)
+{
+    auto converted = g4vg::convert(this->g4world());
+
+    std::string const filename = ::testing::TempDir() + "g4vg-solids.gdml";
+    {
+        std::ofstream os{filename};
+        ASSERT_TRUE(os);
+        write_gdml(converted, os);
+    }
+
+    // Unique VecGeom labels are written, so strip them as for the original
+    G4GDMLParser parser;
+    parser.SetStripFlag(true);
+    parser.Read(filename, /* validate_gdml_schema = */ false);
+    auto const* world = parser.GetWorldVolume();
+    ASSERT_TRUE(world);
+    EXPECT_NE(this->g4world(), world);
+
+    expect_same_volume(*this->g4world()->GetLogicalVolume(),
+                       *world->GetLogicalVolume());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
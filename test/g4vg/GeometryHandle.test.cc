@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/GeometryHandle.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/GeometryHandle.hh"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, update)
+{
+    GeometryHandle handle;
+    EXPECT_FALSE(handle);
+    EXPECT_EQ(0, handle.version());
+    EXPECT_THROW(handle.update(nullptr), std::invalid_argument);
+
+    auto first = handle.update(this->g4world()).get();
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(first->world);
+    EXPECT_EQ(25, first->volume_ids.size());
+    EXPECT_EQ(first, handle.get());
+    EXPECT_EQ(1, handle.version());
+
+    // A reader keeps the old version alive across an update
+    auto second = handle.update(this->g4world()).get();
+    ASSERT_TRUE(second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(second, handle.get());
+    EXPECT_EQ(2, handle.version());
+    EXPECT_EQ(25, first->volume_ids.size());
+    EXPECT_EQ(0, handle.num_retired());
+
+    // Releasing it retires the old version until it is reclaimed
+    first.reset();
+    EXPECT_EQ(1, handle.num_retired());
+    EXPECT_EQ(1, handle.reclaim());
+    EXPECT_EQ(0, handle.num_retired());
+}
+
+TEST_F(SolidsTest, retire_superseded)
+{
+    GeometryHandle handle;
+    std::weak_ptr<Converted const> first
+        = handle.update(this->g4world()).get();
+    ASSERT_FALSE(first.expired());
+
+    // Pending updates must not keep earlier versions alive
+    handle.update(this->g4world()).wait();
+    handle.update(this->g4world()).wait();
+    EXPECT_TRUE(first.expired());
+    EXPECT_EQ(3, handle.version());
+    EXPECT_EQ(1, handle.num_retired());
+    EXPECT_EQ(1, handle.reclaim());
+}
+
+TEST_F(SolidsTest, concurrent_readers)
+{
+    GeometryHandle handle;
+    handle.update(this->g4world()).wait();
+
+    // Readers always see a complete geometry while updates are published
+    constexpr int num_readers = 8;
+    constexpr int num_updates = 4;
+    std::atomic<bool> done{false};
+    std::vector<int> failures(num_readers, 0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < num_readers; ++i)
+    {
+        readers.emplace_back([&handle, &done, &failures, i] {
+            while (!done.load())
+            {
+                auto geo = handle.get();
+                if (!geo || !geo->world || geo->volume_ids.size() != 25)
+                {
+                    ++failures[i];
+                }
+            }
+        });
+    }
+
+    GeometryHandle::FutureConverted last;
+    for (int i = 0; i < num_updates; ++i)
+    {
+        last = handle.update(this->g4world());
+    }
+    auto const latest = last.get();
+    done = true;
+    for (auto& t : readers)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(std::vector<int>(num_readers, 0), failures);
+    EXPECT_EQ(1 + num_updates, handle.version());
+    EXPECT_EQ(latest, handle.get());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/LinearTree.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/LinearTree.hh"
+
+#include <functional>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, linear_tree)
+{
+    Options options;
+    options.linear_tree = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+    auto const& tree = converted.tree;
+
+    // World and its (leaf) daughters
+    auto const num_daughters
+        = converted.world->GetLogicalVolume()->GetDaughters().size();
+    ASSERT_EQ(1 + num_daughters, tree.size());
+    EXPECT_EQ(converted.ids.num_placements() - 1, tree.placed[0]);
+    EXPECT_EQ(LinearTree::no_parent, tree.parent[0]);
+    EXPECT_EQ(tree.size(), tree.skip[0]);
+    EXPECT_EQ(0, tree.depth[0]);
+    for (unsigned int i = 1; i != tree.size(); ++i)
+    {
+        EXPECT_EQ(0u, tree.parent[i]);
+        EXPECT_EQ(i + 1, tree.skip[i]);
+        EXPECT_EQ(1, tree.depth[i]);
+    }
+
+    // Pre-order matches a recursive traversal of the VecGeom placements
+    std::vector<unsigned int> expected;
+    std::function<void(vecgeom::VPlacedVolume const*)> visit;
+    visit = [&](vecgeom::VPlacedVolume const* pv) {
+        expected.push_back(converted.ids.id(*pv));
+        for (auto const* d : pv->GetLogicalVolume()->GetDaughters())
+        {
+            visit(d);
+        }
+    };
+    visit(converted.world);
+    EXPECT_EQ(expected, tree.placed);
+
+    // Stackless traversal that prunes the world visits only the root
+    unsigned int num_visited = 0;
+    for (unsigned int i = 0; i != tree.size(); i = tree.skip[i])
+    {
+        ++num_visited;
+    }
+    EXPECT_EQ(1u, num_visited);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/MaterialTable.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/MaterialTable.hh"
+
+#include <string>
+#include <vector>
+#include <G4LogicalVolume.hh>
+#include <G4Material.hh>
+#include <G4SystemOfUnits.hh>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, materials)
+{
+    auto converted = g4vg::convert(this->g4world());
+    auto const& table = converted.materials;
+
+    // Materials are deduplicated and ordered by first use
+    ASSERT_EQ(2u, table.size());
+    std::vector<std::string> names;
+    for (auto const* mat : table.material)
+    {
+        ASSERT_TRUE(mat);
+        names.push_back(mat->GetName());
+    }
+    EXPECT_EQ((std::vector<std::string>{"Water", "Air"}), names);
+    EXPECT_EQ(table.size(), table.density.size());
+    EXPECT_EQ(table.size(), table.electron_density.size());
+    EXPECT_EQ(table.size(), table.radiation_length.size());
+    EXPECT_EQ(table.size(), table.nuclear_interaction_length.size());
+    EXPECT_EQ(table.size(), table.mean_excitation_energy.size());
+    EXPECT_DOUBLE_EQ(1.0 * CLHEP::g / CLHEP::cm3, table.density[0]);
+    EXPECT_DOUBLE_EQ(0.0001 * CLHEP::g / CLHEP::cm3, table.density[1]);
+
+    // Every converted volume maps back to its Geant4 material
+    ASSERT_EQ(converted.volume_ids.size(), table.volume_material.size());
+    for (auto&& [g4lv, id] : converted.volume_ids)
+    {
+        auto mat_id = table.volume_material[id];
+        ASSERT_LT(mat_id, table.size()) << "for " << g4lv->GetName();
+        G4Material const* mat = g4lv->GetMaterial();
+        EXPECT_EQ(mat, table.material[mat_id]);
+        EXPECT_EQ(mat->GetRadlen(), table.radiation_length[mat_id]);
+        EXPECT_EQ(mat->GetElectronDensity(), table.electron_density[mat_id]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NamePool.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/NamePool.hh"
+
+#include <string>
+#include <gtest/gtest.h>
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(NamePoolTest, empty)
+{
+    NamePool pool;
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(0u, pool.size());
+    EXPECT_EQ(NamePool::invalid_id, pool.find("foo"));
+}
+
+TEST(NamePoolTest, intern)
+{
+    NamePool pool;
+    EXPECT_EQ(0u, pool.insert("box"));
+    EXPECT_EQ(1u, pool.insert("tube"));
+    EXPECT_EQ(0u, pool.insert(std::string{"box"}));
+    EXPECT_EQ(2u, pool.insert(""));
+    EXPECT_EQ(3u, pool.insert("boxes"));
+    EXPECT_EQ(2u, pool.insert(""));
+
+    EXPECT_FALSE(pool.empty());
+    EXPECT_EQ(4u, pool.size());
+    EXPECT_EQ("box", pool[0]);
+    EXPECT_EQ("tube", pool[1]);
+    EXPECT_EQ("", pool[2]);
+    EXPECT_EQ("boxes", pool[3]);
+    EXPECT_EQ(1u, pool.find("tube"));
+    EXPECT_EQ(NamePool::invalid_id, pool.find("bo"));
+    EXPECT_GE(pool.memory_bytes(), 12u);
+}
+
+TEST(NamePoolTest, many)
+{
+    NamePool pool;
+    for (int rep = 0; rep < 3; ++rep)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(static_cast<unsigned int>(i),
+                      pool.insert("module_" + std::to_string(i)));
+        }
+    }
+    EXPECT_EQ(1000u, pool.size());
+    EXPECT_EQ("module_123", pool[123]);
+}
+
+TEST(NamePoolTest, compact)
+{
+    NamePool pool;
+    pool.insert("box");
+    pool.insert("tube");
+    auto const before = pool.memory_bytes();
+    pool.compact();
+    EXPECT_LT(pool.memory_bytes(), before);
+    EXPECT_EQ("tube", pool[1]);
+    EXPECT_EQ(1u, pool.find("tube"));
+    EXPECT_EQ(NamePool::invalid_id, pool.find("cone"));
+
+    // Inserting rebuilds the index
+    EXPECT_EQ(0u, pool.insert("box"));
+    EXPECT_EQ(2u, pool.insert("cone"));
+    EXPECT_EQ(2u, pool.find("cone"));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
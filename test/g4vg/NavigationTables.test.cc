@@ -0,0 +1,154 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NavigationTables.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/NavigationTables.hh"
+
+#include <thread>
+#include <vector>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "g4vg/NumaReplicated.hh"
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, navigation_tables)
+{
+    Options options;
+    options.navigation_tables = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+    ASSERT_TRUE(converted.world);
+    auto const& nav = converted.navigation;
+
+    auto const& ids = converted.ids;
+    auto world_id = ids.id(*converted.world->GetLogicalVolume());
+    ASSERT_EQ(world_id + 1, nav.num_volumes());
+    ASSERT_EQ(ids.num_volumes(), nav.num_volumes());
+    ASSERT_EQ(nav.num_volumes() + 1, nav.daughter_offsets.size());
+    EXPECT_EQ(nav.num_daughters(), nav.daughter_offsets.back());
+    EXPECT_EQ(nav.num_daughters(), nav.daughter_volume.size());
+    EXPECT_EQ(nav.num_daughters() * NavigationTables::transform_size,
+              nav.daughter_transform.size());
+
+    // All volumes are daughters of the world
+    EXPECT_EQ(converted.volume_ids.size() - 1, nav.num_daughters());
+    EXPECT_EQ(0u, nav.daughter_offsets[world_id]);
+
+    // Compare against VecGeom
+    for (auto&& [g4lv, id] : converted.volume_ids)
+    {
+        auto const* vglv = ids.volume(id);
+        ASSERT_TRUE(vglv);
+        EXPECT_EQ(vglv->GetUnplacedVolume(), nav.shape[id]);
+
+        auto const& daughters = vglv->GetDaughters();
+        auto begin = nav.daughter_offsets[id];
+        ASSERT_EQ(daughters.size(), nav.daughter_offsets[id + 1] - begin);
+        for (std::size_t i = 0; i != daughters.size(); ++i)
+        {
+            auto const* pv = daughters[i];
+            auto const slot = begin + i;
+            EXPECT_EQ(pv, nav.daughter[slot]);
+            EXPECT_EQ(slot, ids.id(*pv));
+            EXPECT_EQ(ids.id(*pv->GetLogicalVolume()),
+                      nav.daughter_volume[slot]);
+            double const* xf = nav.daughter_transform.data()
+                               + slot * NavigationTables::transform_size;
+            auto const* vgxf = pv->GetTransformation();
+            EXPECT_EQ(vgxf->Translation(0), xf[0]);
+            EXPECT_EQ(vgxf->Translation(2), xf[2]);
+            EXPECT_EQ(vgxf->Rotation(0), xf[3]);
+            EXPECT_EQ(vgxf->Rotation(8), xf[11]);
+        }
+    }
+}
+
+TEST_F(SolidsTest, numa_tables)
+{
+    Options options;
+    options.navigation_tables = true;
+    options.placement_table = true;
+    options.numa_tables = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+    ASSERT_TRUE(converted.world);
+
+    // Copies are only made if there is more than one node
+    std::size_t const num_copies
+        = numa_node_count() > 1 ? numa_node_count() : 0;
+    ASSERT_EQ(num_copies, converted.numa_navigation.size());
+    ASSERT_EQ(num_copies, converted.numa_placements.size());
+    for (auto const& nav : converted.numa_navigation)
+    {
+        EXPECT_NE(converted.navigation.daughter.data(), nav.daughter.data());
+        EXPECT_EQ(converted.navigation.daughter, nav.daughter);
+        EXPECT_EQ(converted.navigation.daughter_transform,
+                  nav.daughter_transform);
+    }
+    for (auto const& table : converted.numa_placements)
+    {
+        EXPECT_EQ(converted.placements.placed, table.placed);
+        EXPECT_EQ(converted.placements.bbox_upper, table.bbox_upper);
+    }
+
+    // Every thread sees complete tables
+    std::vector<NavigationTables const*> local_nav(4, nullptr);
+    std::vector<PlacementTable const*> local_placements(4, nullptr);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != local_nav.size(); ++t)
+    {
+        threads.emplace_back([&, t] {
+            local_nav[t] = &converted.local_navigation();
+            local_placements[t] = &converted.local_placements();
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (std::size_t t = 0; t != local_nav.size(); ++t)
+    {
+        ASSERT_TRUE(local_nav[t]);
+        EXPECT_EQ(converted.navigation.daughter_volume,
+                  local_nav[t]->daughter_volume);
+        ASSERT_TRUE(local_placements[t]);
+        EXPECT_EQ(converted.placements.copy_number,
+                  local_placements[t]->copy_number);
+    }
+}
+
+TEST_F(SolidsTest, numa_requested_only)
+{
+    Options options;
+    options.navigation_tables = true;
+    options.numa_tables = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+    ASSERT_TRUE(converted.world);
+
+    // Only the requested table is replicated
+    std::size_t const num_copies
+        = numa_node_count() > 1 ? numa_node_count() : 0;
+    EXPECT_EQ(num_copies, converted.numa_navigation.size());
+    EXPECT_EQ(0u, converted.numa_placements.size());
+    EXPECT_EQ(0u, converted.local_placements().placed.size());
+}
+
+TEST_F(SolidsTest, disabled)
+{
+    auto converted = g4vg::convert(this->g4world());
+    EXPECT_EQ(0u, converted.navigation.num_volumes());
+    EXPECT_EQ(0u, converted.navigation.num_daughters());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/NumaReplicated.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/NumaReplicated.hh"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(NumaReplicatedTest, local)
+{
+    std::vector<double> data(1000);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = 0.5 * i;
+    }
+    auto const copies = numa_replicate(data);
+
+    // Each thread sees a complete local copy
+    std::vector<int> nodes(8, -1);
+    std::vector<double> sums(nodes.size(), 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != nodes.size(); ++t)
+    {
+        threads.emplace_back([&, t] {
+            nodes[t] = numa_local_node();
+            for (double v : copies.at(nodes[t]))
+            {
+                sums[t] += v;
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    for (std::size_t t = 0; t != nodes.size(); ++t)
+    {
+        EXPECT_GE(nodes[t], 0);
+        EXPECT_LT(nodes[t], numa_node_count());
+        EXPECT_DOUBLE_EQ(0.5 * 999 * 1000 / 2, sums[t]);
+    }
+}
+
+TEST(NumaReplicatedTest, replicate_containers)
+{
+    std::vector<double> const data{1, 2, 3, 5, 8};
+    auto const copies = numa_replicate(data);
+    ASSERT_EQ(static_cast<std::size_t>(numa_node_count()), copies.size());
+    for (auto const& copy : copies)
+    {
+        EXPECT_NE(data.data(), copy.data());
+        EXPECT_EQ(data, copy);
+    }
+
+    // Errors on the node's thread are passed to the caller
+    EXPECT_THROW(numa_run_on_node(
+                     0, [] { throw std::runtime_error("node failure"); }),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
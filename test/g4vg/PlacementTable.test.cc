@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/PlacementTable.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/PlacementTable.hh"
+
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, placement_table)
+{
+    Options options;
+    options.placement_table = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+    auto const& table = converted.placements;
+    auto const& ids = converted.ids;
+
+    auto const* world_lv = converted.world->GetLogicalVolume();
+    auto const world_id = ids.id(*world_lv);
+    auto const& daughters = world_lv->GetDaughters();
+    ASSERT_EQ(daughters.size(), table.size());
+    ASSERT_EQ(ids.num_placements() - 1, table.size());
+    ASSERT_EQ(world_id + 2, table.offsets.size());
+    EXPECT_EQ(table.size(), table.offsets.back());
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(table.size(), table.translation[i].size());
+        EXPECT_EQ(table.size(), table.bbox_lower[i].size());
+        EXPECT_EQ(table.size(), table.bbox_upper[i].size());
+    }
+    for (auto const& r : table.rotation)
+    {
+        EXPECT_EQ(table.size(), r.size());
+    }
+
+    // All placements are daughters of the world
+    auto const begin = table.offsets[world_id];
+    EXPECT_EQ(0u, begin);
+    using VGVector = vecgeom::Vector3D<vecgeom::Precision>;
+    for (std::size_t i = 0; i != daughters.size(); ++i)
+    {
+        auto const* pv = daughters[i];
+        auto const row = begin + i;
+        EXPECT_EQ(world_id, table.mother[row]);
+        EXPECT_EQ(ids.id(*pv->GetLogicalVolume()), table.volume[row]);
+        EXPECT_EQ(row, table.placed[row]);
+        EXPECT_EQ(pv, ids.placement(row));
+        EXPECT_EQ(pv->GetCopyNo(), table.copy_number[row]);
+        EXPECT_EQ(pv->GetTransformation()->Translation(1),
+                  table.translation[1][row]);
+        EXPECT_EQ(pv->GetTransformation()->Rotation(4),
+                  table.rotation[4][row]);
+
+        // The local bounding box center is inside the mother-frame bbox
+        VGVector lower;
+        VGVector upper;
+        pv->GetUnplacedVolume()->Extent(lower, upper);
+        VGVector const center
+            = pv->GetTransformation()->InverseTransform((lower + upper) / 2.0);
+        for (int ax = 0; ax < 3; ++ax)
+        {
+            EXPECT_LE(table.bbox_lower[ax][row], center[ax]);
+            EXPECT_GE(table.bbox_upper[ax][row], center[ax]);
+            EXPECT_LT(table.bbox_lower[ax][row], table.bbox_upper[ax][row]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
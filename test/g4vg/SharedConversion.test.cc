@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/SharedConversion.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/SharedConversion.hh"
+
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <G4Threading.hh>
+#include <VecGeom/management/GeoManager.h>
+
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, many_workers)
+{
+    SharedConversion shared;
+    EXPECT_FALSE(shared);
+    EXPECT_FALSE(shared.get());
+    EXPECT_THROW(shared.build(nullptr), std::invalid_argument);
+
+    // Convert on the "master" thread
+    auto master = shared.build(this->g4world());
+    ASSERT_TRUE(master);
+    ASSERT_TRUE(master->world);
+    EXPECT_TRUE(shared);
+    EXPECT_EQ(master.get(), shared.build(this->g4world()).get());
+
+    // Workers all see the same immutable result
+    constexpr int num_workers = 64;
+    std::vector<Converted const*> results(num_workers, nullptr);
+    {
+        std::vector<std::thread> workers;
+        for (int i = 0; i < num_workers; ++i)
+        {
+            workers.emplace_back([&shared, &results, i] {
+                auto converted = shared.get();
+                results[i] = converted.get();
+            });
+        }
+        for (auto& t : workers)
+        {
+            t.join();
+        }
+    }
+    for (auto const* r : results)
+    {
+        EXPECT_EQ(master.get(), r);
+    }
+
+    // No copies are retained by the workers
+    EXPECT_EQ(2, master.use_count());
+}
+
+TEST_F(SolidsTest, worker_rejected)
+{
+    SharedConversion shared;
+
+    // Run on a thread that Geant4 considers a worker
+    auto run_on_worker = [](auto&& func) {
+        bool is_worker = false;
+        std::thread worker([&is_worker, &func] {
+            G4Threading::G4SetThreadId(0);
+            is_worker = G4Threading::IsWorkerThread();
+            func();
+        });
+        worker.join();
+        return is_worker;
+    };
+
+    // A worker cannot be the first to convert
+    std::exception_ptr error;
+    bool const is_worker = run_on_worker([this, &shared, &error] {
+        try
+        {
+            shared.build(this->g4world());
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    });
+    if (!is_worker)
+    {
+        GTEST_SKIP() << "Geant4 was built without multithreading";
+    }
+    ASSERT_TRUE(error);
+    EXPECT_THROW(std::rethrow_exception(error), std::logic_error);
+    EXPECT_FALSE(shared);
+
+    // Once the master has converted, workers get the shared result
+    auto master = shared.build(this->g4world());
+    ASSERT_TRUE(master);
+    SharedConversion::SPConstConverted from_worker;
+    run_on_worker([this, &shared, &from_worker] {
+        from_worker = shared.build(this->g4world());
+    });
+    EXPECT_EQ(master, from_worker);
+}
+
+TEST_F(SolidsTest, concurrent_build)
+{
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+
+    // Count the volumes registered by a single conversion
+    auto num_before = vg_manager.GetRegisteredVolumesCount();
+    SharedConversion single;
+    auto expected = single.build(this->g4world());
+    ASSERT_TRUE(expected);
+    auto const num_converted = vg_manager.GetRegisteredVolumesCount()
+                               - num_before;
+    EXPECT_GT(num_converted, 0);
+
+    // Threads racing to build must still convert exactly once
+    SharedConversion shared;
+    num_before = vg_manager.GetRegisteredVolumesCount();
+    constexpr int num_threads = 16;
+    std::vector<SharedConversion::SPConstConverted> results(num_threads);
+    {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back([this, &shared, &results, i] {
+                results[i] = shared.build(this->g4world());
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+    ASSERT_TRUE(results.front());
+    for (auto const& r : results)
+    {
+        EXPECT_EQ(results.front(), r);
+    }
+    EXPECT_EQ(num_threads + 1, results.front().use_count());
+    EXPECT_EQ(num_converted,
+              vg_manager.GetRegisteredVolumesCount() - num_before);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,118 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/SolidConverter.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/SolidConverter.hh"
+
+#include <vector>
+#include <G4ExtrudedSolid.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Orb.hh>
+#include <G4PhysicalConstants.hh>
+#include <G4Tubs.hh>
+#include <VecGeom/management/GeoManager.h>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/UnplacedBox.h>
+#include <VecGeom/volumes/UnplacedExtruded.h>
+
+#include "g4vg/VolumeStore.hh"
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, registered)
+{
+    // Replace the built-in orb conversion with a bounding box
+    int num_calls = 0;
+    SolidConverter::register_type<G4Orb>(
+        [&num_calls](SolidConverter& convert, G4Orb const& solid) {
+            ++num_calls;
+            double const r = convert.scale() * solid.GetRadius();
+            return vecgeom::GeoManager::MakeInstance<vecgeom::UnplacedBox>(
+                r, r, r);
+        });
+
+    auto converted = g4vg::convert(this->g4world());
+    EXPECT_EQ(1, num_calls);
+
+    auto const* orb = this->find_lv("orb1");
+    ASSERT_TRUE(orb);
+    auto const* vglv = converted.ids.volume(converted.volume_ids.at(orb));
+    ASSERT_TRUE(vglv);
+    auto const* box = dynamic_cast<vecgeom::UnplacedBox const*>(
+        vglv->GetUnplacedVolume());
+    ASSERT_TRUE(box);
+    double const r = dynamic_cast<G4Orb const&>(*orb->GetSolid()).GetRadius();
+    EXPECT_DOUBLE_EQ(8 * r * r * r, box->Capacity());
+}
+
+//---------------------------------------------------------------------------//
+//! Client solid with its own conversion
+class TubsBase : public G4Tubs
+{
+  public:
+    using G4Tubs::G4Tubs;
+};
+
+//! Client solid without a conversion
+class DerivedTubs final : public TubsBase
+{
+  public:
+    using TubsBase::TubsBase;
+};
+
+TEST(SolidConverterTest, subclass_fallback)
+{
+    // Registered after the built-in G4Tubs, so it is closer to DerivedTubs
+    int num_calls = 0;
+    SolidConverter::register_type<TubsBase>(
+        [&num_calls](SolidConverter& convert, TubsBase const& solid) {
+            ++num_calls;
+            double const r = convert.scale() * solid.GetOuterRadius();
+            double const hz = convert.scale() * solid.GetZHalfLength();
+            return vecgeom::GeoManager::MakeInstance<vecgeom::UnplacedBox>(
+                r, r, hz);
+        });
+
+    DerivedTubs solid{"derived", 0, 10, 20, 0, CLHEP::twopi};
+    VolumeStore store;
+    SolidConverter convert{1.0, false, &store};
+    auto const* shape = convert(solid);
+    EXPECT_EQ(1, num_calls);
+    EXPECT_TRUE(dynamic_cast<vecgeom::UnplacedBox const*>(shape));
+
+    // The dispatch is remembered
+    EXPECT_EQ(shape, convert(solid));
+    EXPECT_EQ(1, num_calls);
+}
+
+//! Client solid deriving from a built-in type that derives from another
+class DerivedXtru final : public G4ExtrudedSolid
+{
+  public:
+    using G4ExtrudedSolid::G4ExtrudedSolid;
+};
+
+TEST(SolidConverterTest, most_derived_fallback)
+{
+    // G4TessellatedSolid is registered after its subclass G4ExtrudedSolid
+    std::vector<G4TwoVector> const polygon{
+        {-10, -10}, {-10, 10}, {10, 10}, {10, -10}};
+    DerivedXtru solid{"xtru", polygon, 20};
+    VolumeStore store;
+    SolidConverter convert{1.0, false, &store};
+    EXPECT_TRUE(
+        dynamic_cast<vecgeom::UnplacedExtruded const*>(convert(solid)));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/TouchableTransforms.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/TouchableTransforms.hh"
+
+#include <algorithm>
+#include <G4LogicalVolume.hh>
+#include <VecGeom/volumes/LogicalVolume.h>
+#include <VecGeom/volumes/PlacedVolume.h>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+#include "g4vg/Estimate.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, touchable_transforms)
+{
+    Options options;
+    options.touchable_volumes = {this->find_lv("box500"),
+                                 this->find_lv("trd3")};
+    options.touchable_threads = 2;
+    auto converted = g4vg::convert(this->g4world(), options);
+    auto const& tree = converted.tree;
+    auto const& touch = converted.touchables;
+
+    // Tree is built implicitly; one row per placement of the selected LVs
+    ASSERT_FALSE(tree.empty());
+    EXPECT_EQ(2u, touch.size());
+    EXPECT_TRUE(std::is_sorted(touch.node.begin(), touch.node.end()));
+    EXPECT_EQ(touch.node.capacity() * sizeof(unsigned int)
+                  + touch.transform.capacity() * sizeof(double),
+              touch.estimated_bytes);
+    EXPECT_EQ(TouchableTransforms::no_row, touch.row(tree.size()));
+
+    // All daughters are placed directly in the (untransformed) world, so the
+    // global transform of each touchable is its placement transform
+    auto const* world_lv = converted.world->GetLogicalVolume();
+    for (auto const* pv : world_lv->GetDaughters())
+    {
+        unsigned int node = 0;
+        while (tree.placed[node] != converted.ids.id(*pv))
+        {
+            ++node;
+        }
+        unsigned int const row = touch.row(node);
+        auto const* lv = converted.logical_volumes[tree.volume[node]];
+        bool const selected = (lv->GetName() == "box500"
+                               || lv->GetName() == "trd3");
+        if (!selected)
+        {
+            EXPECT_EQ(TouchableTransforms::no_row, row);
+            continue;
+        }
+        ASSERT_NE(TouchableTransforms::no_row, row);
+        EXPECT_EQ(node, touch.node[row]);
+
+        vecgeom::Vector3D<double> const global{123.0, -45.6, 789.0};
+        auto expected = pv->GetTransformation()->Transform(global);
+        auto actual = touch.to_local(row, {global[0], global[1], global[2]});
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_NEAR(expected[i], actual[i], 1e-9) << lv->GetName();
+        }
+    }
+}
+
+TEST_F(SolidsTest, touchable_limit)
+{
+    Options options;
+    options.touchable_volumes = {this->find_lv("box500")};
+    options.max_touchable_bytes = 16;
+    auto converted = g4vg::convert(this->g4world(), options);
+
+    // Estimate is reported but nothing is allocated, not even the tree
+    EXPECT_GT(converted.touchables.estimated_bytes, 16u);
+    EXPECT_TRUE(converted.touchables.empty());
+    EXPECT_TRUE(converted.tree.empty());
+    double const num_rows
+        = count_touchables(this->g4world(), options.touchable_volumes);
+    EXPECT_EQ(1, num_rows);
+    EXPECT_EQ(converted.touchables.estimated_bytes,
+              estimate_touchable_bytes(num_rows));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
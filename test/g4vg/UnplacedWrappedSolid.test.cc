@@ -0,0 +1,134 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/UnplacedWrappedSolid.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/UnplacedWrappedSolid.hh"
+
+#include <G4Box.hh>
+#include <VecGeom/base/SOA3D.h>
+#include <gtest/gtest.h>
+
+#include "g4vg/WrappedSolids.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(UnplacedWrappedSolidTest, box)
+{
+    using Real3 = UnplacedWrappedSolid::Real3;
+
+    // Geant4 box in mm, VecGeom in cm
+    G4Box box("box", 10, 20, 30);
+    UnplacedWrappedSolid wrapped(&box, 0.1);
+    EXPECT_EQ(&box, &wrapped.solid());
+    EXPECT_EQ(0, wrapped.calls());
+
+    EXPECT_TRUE(wrapped.Contains(Real3(0.5, 1.5, 2.5)));
+    EXPECT_EQ(vecgeom::EInside::kOutside, wrapped.Inside(Real3(2, 0, 0)));
+    EXPECT_DOUBLE_EQ(1.0,
+                     wrapped.DistanceToIn(Real3(-2, 0, 0), Real3(1, 0, 0)));
+    EXPECT_DOUBLE_EQ(3.0,
+                     wrapped.DistanceToOut(Real3(0, 0, 0), Real3(0, 0, 1)));
+    EXPECT_DOUBLE_EQ(0.5, wrapped.SafetyToOut(Real3(0.5, 0, 0)));
+    EXPECT_DOUBLE_EQ(2 * 4 * 6, wrapped.Capacity());
+
+    Real3 lower;
+    Real3 upper;
+    wrapped.Extent(lower, upper);
+    EXPECT_DOUBLE_EQ(-2, lower.y());
+    EXPECT_DOUBLE_EQ(3, upper.z());
+
+    // Every call into Geant4 is counted
+    EXPECT_EQ(7, wrapped.calls());
+    EXPECT_GE(wrapped.seconds(), 0);
+
+    WrappedSolids stats;
+    EXPECT_TRUE(stats.empty());
+    stats.shapes = {&wrapped, &wrapped};
+    EXPECT_EQ(2, stats.size());
+    EXPECT_EQ(14, stats.calls());
+    EXPECT_DOUBLE_EQ(2 * wrapped.seconds(), stats.seconds());
+}
+
+//---------------------------------------------------------------------------//
+TEST(UnplacedWrappedSolidTest, wrong_side)
+{
+    using Real3 = UnplacedWrappedSolid::Real3;
+
+    G4Box box("box", 10, 20, 30);
+    UnplacedWrappedSolid wrapped(&box, 0.1);
+
+    // Geant4 returns zero on the wrong side, VecGeom a negative value
+    Real3 const outside(2, 0, 0);
+    Real3 const inside(0.5, 0, 0);
+    EXPECT_EQ(0, box.DistanceToOut(G4ThreeVector(20, 0, 0)));
+    EXPECT_LT(wrapped.DistanceToOut(outside, Real3(1, 0, 0)), 0);
+    EXPECT_LT(wrapped.SafetyToOut(outside), 0);
+    EXPECT_LT(wrapped.SafetyToIn(inside), 0);
+
+    Real3 normal;
+    bool convex = true;
+    EXPECT_LT(
+        wrapped.DistanceToOut(outside, Real3(1, 0, 0), normal, convex), 0);
+    EXPECT_FALSE(convex);
+
+    // Points on the surface are still at zero distance
+    Real3 const surface(1, 0, 0);
+    EXPECT_EQ(vecgeom::EInside::kSurface, wrapped.Inside(surface));
+    EXPECT_DOUBLE_EQ(0, wrapped.SafetyToOut(surface));
+    EXPECT_DOUBLE_EQ(0, wrapped.SafetyToIn(surface));
+    EXPECT_DOUBLE_EQ(0, wrapped.DistanceToOut(surface, Real3(1, 0, 0)));
+}
+
+//---------------------------------------------------------------------------//
+TEST(UnplacedWrappedSolidTest, vector_interfaces)
+{
+    using Real3 = UnplacedWrappedSolid::Real3;
+    using Real_v = UnplacedWrappedSolid::Real_v;
+    using Real3_v = UnplacedWrappedSolid::Real3_v;
+
+    G4Box box("box", 10, 20, 30);
+    UnplacedWrappedSolid wrapped(&box, 0.1);
+
+    // Exiting normal
+    Real3 normal;
+    bool convex = false;
+    EXPECT_DOUBLE_EQ(2.0,
+                     wrapped.DistanceToOut(
+                         Real3(0, 0, 0), Real3(0, -1, 0), normal, convex));
+    EXPECT_DOUBLE_EQ(-1, normal.y());
+    EXPECT_TRUE(convex);
+
+    // SIMD calls loop over lanes
+    std::size_t const num_lanes = vecCore::VectorSize<Real_v>();
+    Real_v const safety = wrapped.SafetyToOutVec(
+        Real3_v(Real_v(0.5), Real_v(0), Real_v(0)));
+    for (std::size_t i = 0; i != num_lanes; ++i)
+    {
+        EXPECT_DOUBLE_EQ(0.5, vecCore::Get(safety, i));
+    }
+    EXPECT_EQ(1 + num_lanes, wrapped.calls());
+
+    // Container calls loop over points
+    vecgeom::SOA3D<double> pos(2);
+    vecgeom::SOA3D<double> dir(2);
+    pos.set(0, Real3(0, 0, 0));
+    pos.set(1, Real3(0.5, 0, 0));
+    dir.set(0, Real3(1, 0, 0));
+    dir.set(1, Real3(0, 0, -1));
+    double const step_max[] = {vecgeom::kInfLength, vecgeom::kInfLength};
+    double dist[2] = {0, 0};
+    wrapped.DistanceToOut(pos, dir, step_max, dist);
+    EXPECT_DOUBLE_EQ(1.0, dist[0]);
+    EXPECT_DOUBLE_EQ(3.0, dist[1]);
+    EXPECT_EQ(3 + num_lanes, wrapped.calls());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/UnreachableReport.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/UnreachableReport.hh"
+
+#include <memory>
+#include <G4Box.hh>
+#include <G4LogicalVolume.hh>
+#include <G4MultiUnion.hh>
+#include <G4ScaledSolid.hh>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, unreachable)
+{
+    auto const before = find_unreachable(this->g4world());
+
+    // Add a volume that's never placed
+    auto box = std::make_unique<G4Box>("orphan", 1, 2, 3);
+    auto lv = std::make_unique<G4LogicalVolume>(box.get(), nullptr, "orphan");
+
+    auto const after = find_unreachable(this->g4world());
+    EXPECT_TRUE(after);
+    EXPECT_EQ(before.logical_volumes + 1, after.logical_volumes);
+    EXPECT_EQ(before.physical_volumes, after.physical_volumes);
+    EXPECT_EQ(before.solids + 1, after.solids);
+
+    // Conversion skips it and estimates the savings
+    Options options;
+    options.report_unreachable = true;
+    auto converted = g4vg::convert(this->g4world(), options);
+    EXPECT_EQ(0u, converted.volume_ids.count(lv.get()));
+    EXPECT_EQ(after.logical_volumes, converted.unreachable.logical_volumes);
+    EXPECT_EQ(after.solids, converted.unreachable.solids);
+    EXPECT_GT(converted.unreachable.estimated_bytes, 0u);
+    EXPECT_GT(converted.unreachable.estimated_seconds, 0);
+
+    // Other live geometries don't affect the estimate
+    auto again = g4vg::convert(this->g4world(), options);
+    EXPECT_EQ(converted.unreachable.estimated_bytes,
+              again.unreachable.estimated_bytes);
+
+    // Without the option, nothing is reported
+    EXPECT_FALSE(g4vg::convert(this->g4world()).unreachable);
+}
+
+TEST_F(SolidsTest, unreachable_constituents)
+{
+    auto const before = find_unreachable(this->g4world());
+
+    // Replace a box with a union of itself and a scaled box
+    auto* lv = this->find_lv("box500");
+    ASSERT_TRUE(lv);
+    auto* orig_solid = lv->GetSolid();
+    G4Box box{"scaled_box", 10, 10, 10};
+    G4ScaledSolid scaled{"scaled", &box, G4Scale3D{1, 1, 2}};
+    G4MultiUnion multi{"mu"};
+    multi.AddNode(*orig_solid, G4Transform3D{});
+    multi.AddNode(scaled, G4Translate3D{0, 0, 100});
+    multi.Voxelize();
+    lv->SetSolid(&multi);
+
+    // All new solids are reachable through the union
+    auto const after = find_unreachable(this->g4world());
+    lv->SetSolid(orig_solid);
+    EXPECT_EQ(before.solids, after.solids);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
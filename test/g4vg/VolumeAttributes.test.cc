@@ -0,0 +1,114 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeAttributes.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/VolumeAttributes.hh"
+
+#include <string>
+#include <vector>
+#include <G4FieldManager.hh>
+#include <G4GDMLAuxStructType.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Region.hh>
+#include <G4VSensitiveDetector.hh>
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class NullSensitiveDetector final : public G4VSensitiveDetector
+{
+  public:
+    using G4VSensitiveDetector::G4VSensitiveDetector;
+
+  protected:
+    G4bool ProcessHits(G4Step*, G4TouchableHistory*) final { return true; }
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, attributes)
+{
+    G4LogicalVolume* box = this->find_lv("box500");
+    G4LogicalVolume* cone = this->find_lv("cone1");
+    G4LogicalVolume* trd = this->find_lv("trd1");
+    ASSERT_TRUE(box && cone && trd);
+
+    // Attach a detector and field to some volumes
+    NullSensitiveDetector sd{"box_sd"};
+    G4FieldManager field_manager;
+    box->SetSensitiveDetector(&sd);
+    cone->SetFieldManager(&field_manager, /* forceToAllDaughters = */ false);
+
+    // Use the auxiliary tags of the GDML volumes
+    auto const& gdml_aux = this->gdml_aux();
+    ASSERT_EQ(2u, gdml_aux.size());
+    ASSERT_EQ(1u, gdml_aux.count(box));
+    ASSERT_EQ(1u, gdml_aux.count(cone));
+
+    Options options;
+    options.gdml_aux = &gdml_aux;
+    auto converted = g4vg::convert(this->g4world(), options);
+    auto const& attrs = converted.attributes;
+
+    box->SetSensitiveDetector(nullptr);
+    cone->SetFieldManager(nullptr, false);
+
+    // Compare against Geant4
+    auto const num_volumes = attrs.num_volumes();
+    ASSERT_EQ(num_volumes, attrs.sensitive.size());
+    ASSERT_EQ(num_volumes, attrs.field.size());
+    ASSERT_EQ(num_volumes, attrs.volume_cuts.size());
+    ASSERT_EQ(num_volumes + 1, attrs.aux_offsets.size());
+    ASSERT_EQ(attrs.regions.size(), attrs.region_cuts.size());
+    for (auto&& [g4lv, id] : converted.volume_ids)
+    {
+        ASSERT_LT(id, num_volumes);
+        EXPECT_EQ(g4lv == box, attrs.sensitive[id]) << g4lv->GetName();
+        EXPECT_EQ(g4lv == cone, attrs.field[id]) << g4lv->GetName();
+
+        auto region_id = attrs.volume_region[id];
+        if (G4Region const* region = g4lv->GetRegion())
+        {
+            ASSERT_LT(region_id, attrs.regions.size());
+            EXPECT_EQ(region, attrs.regions[region_id]);
+            EXPECT_EQ(attrs.region_cuts[region_id], attrs.volume_cuts[id]);
+        }
+        else
+        {
+            EXPECT_EQ(VolumeAttributes::invalid_id, region_id);
+        }
+    }
+
+    // Trapezoids are in the region defined by the GDML user info
+    auto trd_region = attrs.volume_region[converted.volume_ids.at(trd)];
+    ASSERT_LT(trd_region, attrs.regions.size());
+    EXPECT_EQ("Turds", attrs.regions[trd_region]->GetName());
+
+    // Check auxiliary data
+    EXPECT_EQ(3u, attrs.aux.size());
+    auto [box_begin, box_end] = attrs.auxiliary(converted.volume_ids.at(box));
+    ASSERT_EQ(1, box_end - box_begin);
+    EXPECT_EQ("SensDet", box_begin->type);
+    EXPECT_EQ("Tracker", box_begin->value);
+    auto [cone_begin, cone_end]
+        = attrs.auxiliary(converted.volume_ids.at(cone));
+    ASSERT_EQ(2, cone_end - cone_begin);
+    EXPECT_EQ("Color", cone_begin[0].type);
+    EXPECT_EQ("red", cone_begin[0].value);
+    EXPECT_EQ("Cut", cone_begin[1].type);
+    EXPECT_EQ("1", cone_begin[1].value);
+    EXPECT_EQ("mm", cone_begin[1].unit);
+    auto [trd_begin, trd_end] = attrs.auxiliary(converted.volume_ids.at(trd));
+    EXPECT_EQ(trd_begin, trd_end);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg
@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file g4vg/VolumeStore.test.cc
+//---------------------------------------------------------------------------//
+#include "g4vg/VolumeStore.hh"
+
+#include <cstddef>
+#include <fstream>
+#include <utility>
+#include <unistd.h>
+#include <G4Box.hh>
+#include <G4MultiUnion.hh>
+#include <G4Transform3D.hh>
+#include <VecGeom/management/GeoManager.h>
+
+#include "g4vg/SolidConverter.hh"
+
+#include "G4VG.hh"
+#include "G4VGTestBase.hh"
+
+namespace g4vg
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+//! Resident set size [bytes], or zero if unavailable
+std::size_t resident_bytes()
+{
+    std::ifstream statm{"/proc/self/statm"};
+    std::size_t total_pages{0};
+    std::size_t resident_pages{0};
+    if (!(statm >> total_pages >> resident_pages))
+    {
+        return 0;
+    }
+    return resident_pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+//---------------------------------------------------------------------------//
+//! Multi-union of two boxes, which the GDML test geometry lacks
+struct MultiUnionSolid
+{
+    G4Box box{"mu_box", 10, 10, 10};
+    G4MultiUnion solid{"mu"};
+
+    MultiUnionSolid()
+    {
+        solid.AddNode(box, G4Transform3D{});
+        solid.AddNode(box, G4Translate3D{15, 0, 0});
+        solid.Voxelize();
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(SolidsTest, ownership)
+{
+    auto& vg_manager = vecgeom::GeoManager::Instance();
+    auto const num_lv = vg_manager.GetLogicalVolumesMap().size();
+    auto const num_pv = vg_manager.GetPlacedVolumesCount();
+
+    {
+        auto converted = g4vg::convert(this->g4world());
+        ASSERT_TRUE(converted.world);
+        EXPECT_FALSE(converted.store.empty());
+        EXPECT_LT(num_lv, vg_manager.GetLogicalVolumesMap().size());
+
+        // Moving transfers ownership
+        auto moved = std::move(converted);
+        EXPECT_TRUE(converted.store.empty());
+        EXPECT_FALSE(moved.store.empty());
+    }
+
+    // Every volume deregistered itself when deleted
+    EXPECT_EQ(num_lv, vg_manager.GetLogicalVolumesMap().size());
+    EXPECT_EQ(num_pv, vg_manager.GetPlacedVolumesCount());
+
+    // Multi-union nodes are owned by the store
+    MultiUnionSolid multi;
+    {
+        VolumeStore store;
+        SolidConverter convert{1.0, false, &store};
+        EXPECT_TRUE(convert(multi.solid));
+        EXPECT_EQ(2, store.volumes().size());
+        EXPECT_EQ(2, store.placed().size());
+        EXPECT_EQ(num_lv + 2, vg_manager.GetLogicalVolumesMap().size());
+    }
+    EXPECT_EQ(num_lv, vg_manager.GetLogicalVolumesMap().size());
+    EXPECT_EQ(num_pv, vg_manager.GetPlacedVolumesCount());
+}
+
+TEST_F(SolidsTest, stress)
+{
+    if (resident_bytes() == 0)
+    {
+        GTEST_SKIP() << "resident set size is unavailable";
+    }
+
+    Options options;
+    options.navigation_tables = true;
+    options.placement_table = true;
+    options.compact_transforms = true;
+    MultiUnionSolid multi;
+    auto convert_many = [this, &options, &multi](int count) {
+        for (int i = 0; i != count; ++i)
+        {
+            {
+                // Multi-union nodes are deleted with their store
+                VolumeStore store;
+                SolidConverter convert{1.0, false, &store};
+                ASSERT_TRUE(convert(multi.solid));
+                ASSERT_EQ(2, store.placed().size());
+            }
+
+            auto converted = g4vg::convert(this->g4world(), options);
+            ASSERT_TRUE(converted.world);
+            ASSERT_FALSE(converted.store.empty());
+
+            // Per-ID tables stay dense although VecGeom IDs keep growing
+            constexpr std::size_t num_lv = 25;
+            constexpr std::size_t num_pv = 25;
+            auto const& ids = converted.ids;
+            ASSERT_EQ(num_lv, ids.num_volumes());
+            ASSERT_EQ(num_pv, ids.num_placements());
+            ASSERT_EQ(num_lv + 4, ids.all_volumes().size());
+            ASSERT_EQ(num_lv, converted.logical_volumes.size());
+            ASSERT_EQ(num_lv, converted.volume_names.size());
+            ASSERT_EQ(num_lv, converted.materials.volume_material.size());
+            ASSERT_EQ(num_lv, converted.attributes.volume_region.size());
+            ASSERT_EQ(num_lv, converted.navigation.num_volumes());
+            ASSERT_EQ(num_lv + 1, converted.placements.offsets.size());
+            ASSERT_EQ(num_pv, converted.transforms.size());
+        }
+    };
+
+    // Let allocator pools and Geant4 caches reach a steady state
+    convert_many(10);
+    auto const initial_bytes = resident_bytes();
+
+    convert_many(1000);
+    auto const final_bytes = resident_bytes();
+
+    // Leaking the geometry would cost several megabytes
+    EXPECT_LT(final_bytes, initial_bytes + (2u << 20))
+        << "RSS grew from " << initial_bytes << " to " << final_bytes
+        << " bytes";
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4vg